@@ -0,0 +1,37 @@
+#include <algorithm>	// sort, find_if
+
+#include "aoc.h"
+
+/* aoc_days.h is written by cmake, AOC_DAY_SOLVER(n) for each day linked
+ * in. Each day's aoc_solver() is renamed aoc_solver_dayN as it goes into
+ * the library so they do not collide.
+ */
+#define AOC_DAY_SOLVER(n) extern "C" const aoc_solver_t *aoc_solver_day##n();
+#include "aoc_days.h"
+#undef AOC_DAY_SOLVER
+
+const std::vector<const aoc_solver_t *> &aoc_solvers() {
+	static const std::vector<const aoc_solver_t *> solvers = []() {
+		std::vector<const aoc_solver_t *> days = {
+#define AOC_DAY_SOLVER(n) aoc_solver_day##n(),
+#include "aoc_days.h"
+#undef AOC_DAY_SOLVER
+		};
+
+		std::sort(days.begin(), days.end(), [](const aoc_solver_t *a, const aoc_solver_t *b) {
+			return a->day < b->day;
+		});
+		return days;
+	}();
+
+	return solvers;
+}
+
+const aoc_solver_t *aoc_find_solver(int day) {
+	const auto &solvers = aoc_solvers();
+	auto found = std::find_if(solvers.begin(), solvers.end(), [day](const aoc_solver_t *solver) {
+		return solver->day == day;
+	});
+
+	return found == solvers.end() ? nullptr : *found;
+}
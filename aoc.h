@@ -0,0 +1,27 @@
+#if !defined(AOC_H)
+#define AOC_H
+
+#include <vector>		// std::vector
+
+#include "aoc_solver.h"
+
+/* libaoc, every day's solution in one shared library (see the top level
+ * CMakeLists.txt). Link with it and include this:
+ *
+ *	const aoc_solver_t *solver = aoc_find_solver(15);
+ *	void *data = solver->parse("day15/input.txt");
+ *	std::string p1 = solver->part1(data);
+ *	std::string p2 = solver->part2(data);
+ *	solver->release(data);
+ *
+ * Everything else in the library, the days' own code and the common/ code
+ * they share, stays inside it; only the registry below is exported.
+ */
+
+// all the days in the library, in day order
+const std::vector<const aoc_solver_t *> &aoc_solvers();
+
+// the solver for day, nullptr if the library has none
+const aoc_solver_t *aoc_find_solver(int day);
+
+#endif
@@ -0,0 +1,311 @@
+#include <getopt.h>     // getopt() argument processing
+#include <chrono>       // steady clock
+#include <fstream>      // ifstream (reading file)
+#include <iostream>		// cout
+#include <iomanip>		// setw and setprecision on output
+#include <sstream>		// istringstream
+#include <filesystem>	// file sizes and paths
+
+#include <vector>		// collectin
+#include <string>		// strings
+#include <array>		// fixed size collections
+#include <map>			// map
+#include <algorithm>	// sort
+#include <cstdlib>		// atoi
+#include <cmath>		// ceil, exp, log
+
+#include "aoc.h"
+
+/*
+	aoc_bench [-n runs] [-w warmup] [-f input.txt] [-i dir] [-s save] [-c compare] [-v] [day...]
+
+	runs each day's read_data, part1 and part2 from libaoc on
+	dayN/input.txt in this process, warmup times untimed and then runs
+	times timed. Reports min/median/p99 for each phase and the input
+	throughput at the median total.
+
+	If dayN/answer.txt has a line for the input, the answers are checked
+	against it like summary did (a * in front of a right answer).
+
+	day1 (input.txt, 9.8KiB, 100 runs)
+	                    min          median             p99
+	  parse        0.0701ms        0.0734ms        0.0920ms
+	  part1        0.0012ms        0.0013ms        0.0019ms
+	  part2        0.0044ms        0.0046ms        0.0061ms
+	  total        0.0761ms        0.0793ms        0.1001ms  126.3MB/s
+	  p1=*1446  p2=*1486
+
+	-s writes each day's medians to a file, -c reads one back and puts the
+	speedup over it at the end of each line, then the geometric mean of the
+	totals over every day in both. Two builds on the same inputs:
+
+	build/release/aoc_bench -s release.txt
+	build/pgo/aoc_bench -c release.txt
+
+	  part2        0.0031ms        0.0033ms        0.0047ms   1.39x
+	  total        0.0702ms        0.0731ms        0.0911ms   1.08x  137.0MB/s
+	...
+	total 1.12x over 23 days
+*/
+
+using namespace std;
+
+/* verbosity level; 0 = nothing extra, 1 = more... Set by command line. */
+static int verbose = 0;
+static int runs = 20;
+static int warmup = 3;
+static string input_name = "input.txt";
+static filesystem::path input_dir = ".";
+static string save_file = "";
+static string compare_file = "";
+static int time_width = 12;
+static int time_precision = 4;
+
+using sample_clock = chrono::steady_clock;		// never jumps, unlike high_resolution_clock may
+
+struct stats_t {
+	vector<sample_clock::duration> samples{};
+
+	void add(sample_clock::duration d) {
+		samples.push_back(d);
+	}
+
+	// q in [0, 1], nearest rank
+	sample_clock::duration quantile(double q) {
+		sort(samples.begin(), samples.end());
+		const auto rank = static_cast<size_t>(ceil(q * static_cast<double>(samples.size())));
+		return samples[min(samples.size() - 1, rank > 0 ? rank - 1 : 0)];
+	}
+};
+
+// median nanoseconds for parse, part1, part2 and total
+using medians_t = array<double, 4>;
+
+// the -c file, by day
+static map<int, medians_t> baseline;
+static vector<double> speedups;
+
+// "day15 52113 403 48120221 48172737", one line a day as -s writes them
+map<int, medians_t> read_medians(const string &filename) {
+	map<int, medians_t> days;
+
+	std::ifstream ifs(filename);
+	string day;
+	medians_t medians;
+	while (ifs >> day >> medians[0] >> medians[1] >> medians[2] >> medians[3]) {
+		days[atoi(day.substr(3).c_str())] = medians;
+	}
+
+	return days;
+}
+
+struct answer_t {
+	string p1{};
+	string p2{};
+};
+
+// expected answers for filename from answer.txt ("input.txt: 1446 1486")
+const answer_t read_answer(const filesystem::path &answer_file, const string &filename) {
+	std::ifstream ifs(answer_file);
+	string name;
+	answer_t answer;
+	while (ifs >> name) {
+		string line;
+		getline(ifs, line);
+		if (name == filename + ":" || name == filename) {
+			istringstream(line) >> answer.p1 >> answer.p2;
+			break;
+		}
+	}
+
+	return answer;
+}
+
+double nanoseconds(sample_clock::duration d) {
+	return chrono::duration<double, nano>(d).count();
+}
+
+// before is the baseline median in nanoseconds, 0 for none
+void print_time(const string &label, stats_t &stats, double before) {
+	cout << "  " << setw(5) << left << label << right << fixed << setprecision(time_precision);
+	for (const double q : {0.0, 0.5, 0.99}) {
+		cout << "  " << setw(time_width) << nanoseconds(stats.quantile(q)) / 1e6 << "ms";
+	}
+
+	if (before > 0) {
+		cout << "  " << setw(5) << setprecision(2) << before / nanoseconds(stats.quantile(0.5)) << "x";
+	}
+}
+
+void print_answer(const string &label, const string &result, const string &expected) {
+	if (expected.empty()) {
+		cout << label << "= ";
+	} else if (result == expected) {
+		cout << label << "=\033[1;97m*";
+	} else {
+		cout << label << "=\033[1;91m!";
+	}
+
+	cout << result << "\033[0m  ";
+}
+
+void bench(const aoc_solver_t &solver) {
+	const string day = "day" + to_string(solver.day);
+	const auto input_file = input_dir / day / input_name;
+	if (!filesystem::exists(input_file)) {
+		if (verbose > 0) {
+			cout << day << " (no " << input_file.string() << ")" << endl;
+		}
+		return;
+	}
+
+	const auto bytes = filesystem::file_size(input_file);
+	const string filename = input_file.string();
+
+	string p1_result;
+	string p2_result;
+	stats_t parse, p1, p2, total;
+	for (int run = 0; run < warmup + runs; run++) {
+		auto start_time = sample_clock::now();
+
+		void *data = solver.parse(filename);
+
+		auto parse_time = sample_clock::now();
+
+		p1_result = solver.part1(data);
+
+		auto p1_time = sample_clock::now();
+
+		p2_result = solver.part2(data);
+
+		auto p2_time = sample_clock::now();
+
+		solver.release(data);
+
+		if (run >= warmup) {
+			parse.add(parse_time - start_time);
+			p1.add(p1_time - parse_time);
+			p2.add(p2_time - p1_time);
+			total.add(p2_time - start_time);
+		}
+	}
+
+	cout << day << " (" << input_name << ", " << setprecision(1) << fixed
+		<< static_cast<double>(bytes) / 1024.0 << "KiB, " << runs << " runs)" << endl;
+	cout << "       ";
+	for (const char *label : {"min", "median", "p99"}) {
+		cout << "  " << setw(time_width + 2) << label;
+	}
+	cout << endl;
+
+	const medians_t medians = {
+		nanoseconds(parse.quantile(0.5)), nanoseconds(p1.quantile(0.5)),
+		nanoseconds(p2.quantile(0.5)), nanoseconds(total.quantile(0.5))
+	};
+	const medians_t before = baseline.contains(solver.day) ? baseline[solver.day] : medians_t{};
+
+	print_time("parse", parse, before[0]);
+	cout << endl;
+	print_time("part1", p1, before[1]);
+	cout << endl;
+	print_time("part2", p2, before[2]);
+	cout << endl;
+	print_time("total", total, before[3]);
+	if (before[3] > 0) {
+		speedups.push_back(before[3] / medians[3]);
+	}
+
+	const double seconds = chrono::duration<double>(total.quantile(0.5)).count();
+	cout << "  " << setprecision(1) << static_cast<double>(bytes) / seconds / 1e6 << "MB/s" << endl;
+
+	const answer_t expected = read_answer(input_dir / day / "answer.txt", input_name);
+	cout << "  ";
+	print_answer("p1", p1_result, expected.p1);
+	print_answer("p2", p2_result, expected.p2);
+	cout << endl;
+
+	if (!save_file.empty()) {
+		std::ofstream ofs(save_file, ios::app);
+		ofs << day << fixed << setprecision(0);
+		for (const double m : medians) {
+			ofs << " " << m;
+		}
+		ofs << endl;
+	}
+}
+
+void usage(const char *program) {
+	cerr << "usage: " << program << " [-n runs] [-w warmup] [-f input.txt] [-i input dir] [-s save] [-c compare] [-v] [day...]" << endl;
+	exit(1);
+}
+
+int main(int argc, char *argv[]) {
+	int opt;
+	while ((opt = getopt(argc, argv, "n:w:f:i:s:c:v")) != -1) {
+		switch (opt) {
+		case 'n':
+			runs = max(1, atoi(optarg));
+			break;
+		case 'w':
+			warmup = max(0, atoi(optarg));
+			break;
+		case 'f':
+			input_name = optarg;
+			break;
+		case 'i':
+			input_dir = optarg;
+			break;
+		case 's':
+			save_file = optarg;
+			break;
+		case 'c':
+			compare_file = optarg;
+			break;
+		case 'v':
+			verbose++;
+			break;
+		default:
+			usage(argv[0]);
+		}
+	}
+
+	vector<int> days;
+	for (int i = optind; i < argc; i++) {
+		string arg = argv[i];
+		if (arg.starts_with("day")) {
+			arg = arg.substr(3);
+		}
+		days.push_back(atoi(arg.c_str()));
+	}
+
+	if (days.empty()) {
+		for (const aoc_solver_t *solver : aoc_solvers()) {
+			days.push_back(solver->day);
+		}
+	}
+
+	if (!compare_file.empty()) {
+		baseline = read_medians(compare_file);
+	}
+	if (!save_file.empty()) {
+		std::ofstream(save_file).close();		// each day appends its line
+	}
+
+	for (const int day : days) {
+		const aoc_solver_t *solver = aoc_find_solver(day);
+		if (solver) {
+			bench(*solver);
+		} else if (verbose > 0) {
+			cout << "day" << day << " (no solver)" << endl;
+		}
+	}
+
+	if (!speedups.empty()) {
+		double log_sum = 0;
+		for (const double speedup : speedups) {
+			log_sum += log(speedup);
+		}
+		cout << "total " << setprecision(2) << exp(log_sum / static_cast<double>(speedups.size()))
+			<< "x over " << speedups.size() << " days" << endl;
+	}
+}
@@ -0,0 +1,921 @@
+#include <getopt.h>     // getopt() argument processing
+#include <iostream>		// cout
+#include <iomanip>		// setw on output
+#include <fstream>      // ofstream (writing file)
+
+#include <vector>		// collectin
+#include <string>		// strings
+#include <array>		// fixed size collections
+#include <set>			// set
+#include <algorithm>	// sort, swap
+#include <numeric>		// iota
+#include <limits>		// numeric_limits
+#include <cmath>		// hypot
+#include <cstdint>		// uint64_t
+#include <cstdlib>		// atoi, strtoull
+
+/*
+	aoc_gen [-s seed] [-n scale] [-o file] day
+	aoc_gen -l
+
+	writes a valid puzzle input for day, scale big (what scale counts and
+	its default for each day, see -l). The same seed and scale always give
+	the same file, on any machine; the random numbers are our own
+	splitmix64, not <random>.
+
+	aoc_gen -n 10000 15 > day15/big.txt		10k x 10k risk map
+	aoc_gen -n 100000 22 > day22/big.txt	100k cuboids
+	aoc_gen -n 500 19 > day19/big.txt		500 scanners
+	aoc_gen -n 100000 18 > day18/big.txt	100k snailfish numbers
+
+	The inputs keep the promises the puzzles make (day3 numbers are all
+	different, day13 dots are never on a fold, day19 scanners each share
+	at least 12 beacons with the one before...). Some puzzles do not
+	scale, the usage and -l list how far each goes. day12 and day23 turn
+	down a scale past what their solutions can hold. day11 has no hard
+	limit, but a random grid seldom ever flashes all at once, so part 2
+	may never end; day12 paths grow exponentially in small caves.
+
+	Not every solution keeps up either. day19 keeps every pair distance of
+	the merged cloud, so time and memory grow with the square of the
+	beacons; 100 scanners take about 2s, 500 about 3 minutes and 4.5GB.
+*/
+
+using namespace std;
+
+static uint64_t seed = 2021;
+static size_t scale = 0;		// 0 is the day's default
+
+/* splitmix64, small and the same everywhere */
+struct rng_t {
+	uint64_t state;
+
+	explicit rng_t(uint64_t seed) : state(seed) {
+	}
+
+	uint64_t next() {
+		uint64_t z = (state += 0x9e3779b97f4a7c15ULL);
+		z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+		z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+		return z ^ (z >> 31);
+	}
+
+	// 0 .. n-1
+	uint64_t below(uint64_t n) {
+		return next() % n;
+	}
+
+	// lo .. hi inclusive
+	long range(long lo, long hi) {
+		return lo + static_cast<long>(below(static_cast<uint64_t>(hi - lo + 1)));
+	}
+
+	// true one time in n
+	bool one_in(uint64_t n) {
+		return below(n) == 0;
+	}
+
+	template <typename T>
+	void shuffle(T &items) {
+		for (size_t i = items.size(); i > 1; i--) {
+			swap(items[i - 1], items[below(i)]);
+		}
+	}
+};
+
+// comma separated
+template <typename T>
+void write_list(ostream &out, const vector<T> &items) {
+	for (size_t i = 0; i < items.size(); i++) {
+		out << (i ? "," : "") << items[i];
+	}
+	out << "\n";
+}
+
+// size x size of digits lo..hi
+void write_digits(ostream &out, rng_t &rng, size_t size, int lo, int hi) {
+	string row(size, '0');
+	for (size_t y = 0; y < size; y++) {
+		for (auto &c : row) {
+			c = static_cast<char>('0' + rng.range(lo, hi));
+		}
+		out << row << "\n";
+	}
+}
+
+/* Day 1: depths, one per line, wandering mostly down */
+void day1(ostream &out, rng_t &rng, size_t n) {
+	long depth = rng.range(100, 200);
+	for (size_t i = 0; i < n; i++) {
+		depth = max(1L, depth + rng.range(-8, 12));
+		out << depth << "\n";
+	}
+}
+
+/* Day 2: forward/down/up, never above the surface */
+void day2(ostream &out, rng_t &rng, size_t n) {
+	long depth = 0;
+	for (size_t i = 0; i < n; i++) {
+		const long distance = rng.range(1, 9);
+		switch (rng.below(3)) {
+			case 0:
+				out << "forward " << distance << "\n";
+				break;
+			case 1:
+				depth += distance;
+				out << "down " << distance << "\n";
+				break;
+			default:
+				if (depth >= distance) {
+					depth -= distance;
+					out << "up " << distance << "\n";
+				} else {
+					out << "forward " << distance << "\n";
+				}
+				break;
+		}
+	}
+}
+
+/* Day 3: n different binary numbers, at least 12 bits */
+void day3(ostream &out, rng_t &rng, size_t n) {
+	size_t bits = 12;
+	while ((size_t{1} << bits) < 2 * n) {
+		bits++;
+	}
+
+	set<uint64_t> seen;
+	while (seen.size() < n) {
+		const uint64_t value = rng.below(uint64_t{1} << bits);
+		if (seen.insert(value).second) {
+			for (size_t b = bits; b-- > 0;) {
+				out << ((value >> b) & 1);
+			}
+			out << "\n";
+		}
+	}
+}
+
+/* Day 4: all of 0..99 drawn, n boards of 25 different numbers */
+void day4(ostream &out, rng_t &rng, size_t n) {
+	vector<int> numbers(100);
+	iota(numbers.begin(), numbers.end(), 0);
+
+	rng.shuffle(numbers);
+	write_list(out, numbers);
+
+	for (size_t b = 0; b < n; b++) {
+		rng.shuffle(numbers);
+		out << "\n";
+		for (size_t i = 0; i < 25; i++) {
+			out << setw(2) << numbers[i] << ((i % 5 == 4) ? "\n" : " ");
+		}
+	}
+}
+
+/* Day 5: n vent lines, horizontal, vertical or 45 degrees, in 0..999 */
+void day5(ostream &out, rng_t &rng, size_t n) {
+	for (size_t i = 0; i < n; i++) {
+		const long x1 = rng.range(10, 989);
+		const long y1 = rng.range(10, 989);
+		const long length = rng.range(1, 500);
+		long dx = 0;
+		long dy = 0;
+		switch (rng.below(3)) {
+			case 0:
+				dx = rng.one_in(2) ? 1 : -1;
+				break;
+			case 1:
+				dy = rng.one_in(2) ? 1 : -1;
+				break;
+			default:
+				dx = rng.one_in(2) ? 1 : -1;
+				dy = rng.one_in(2) ? 1 : -1;
+				break;
+		}
+
+		// shorten to stay on the 0..999 floor
+		long steps = length;
+		while (x1 + dx * steps < 0 || x1 + dx * steps > 999 || y1 + dy * steps < 0 || y1 + dy * steps > 999) {
+			steps--;
+		}
+
+		out << x1 << "," << y1 << " -> " << x1 + dx * steps << "," << y1 + dy * steps << "\n";
+	}
+}
+
+/* Day 6: n lanternfish timers 1..5 */
+void day6(ostream &out, rng_t &rng, size_t n) {
+	vector<long> fish(n);
+	for (auto &f : fish) {
+		f = rng.range(1, 5);
+	}
+	write_list(out, fish);
+}
+
+/* Day 7: n crab positions, most of them low */
+void day7(ostream &out, rng_t &rng, size_t n) {
+	vector<uint64_t> crabs(n);
+	for (auto &c : crabs) {
+		c = rng.below(2000) * rng.below(2000) / 2000;
+	}
+	write_list(out, crabs);
+}
+
+/* Day 8: n displays, each with its own wiring of the segments */
+void day8(ostream &out, rng_t &rng, size_t n) {
+	const array<string, 10> digits = {
+		"abcefg", "cf", "acdeg", "acdfg", "bcdf", "abdfg", "abdefg", "acf", "abcdefg", "abcdfg"
+	};
+
+	for (size_t i = 0; i < n; i++) {
+		string wiring = "abcdefg";
+		rng.shuffle(wiring);
+
+		auto wire = [&wiring, &rng](const string &segments) {
+			string wired;
+			for (const char s : segments) {
+				wired.push_back(wiring[static_cast<size_t>(s - 'a')]);
+			}
+			rng.shuffle(wired);
+			return wired;
+		};
+
+		array<size_t, 10> order;
+		iota(order.begin(), order.end(), 0);
+		rng.shuffle(order);
+		for (const size_t d : order) {
+			out << wire(digits[d]) << " ";
+		}
+
+		out << "|";
+		for (size_t k = 0; k < 4; k++) {
+			out << " " << wire(digits[rng.below(10)]);
+		}
+		out << "\n";
+	}
+}
+
+/* Day 9: n x n heights in basins around random low points, 9 where two
+ * basins meet and rising away from the low point up to 8 inside.
+ */
+void day9(ostream &out, rng_t &rng, size_t n) {
+	struct low_t {
+		long x, y;
+	};
+
+	// a low point about every 50 squares, in a 16 x 16 bucket grid to find them
+	const size_t buckets = 16;
+	const long bucket_size = static_cast<long>((n + buckets - 1) / buckets);
+	vector<vector<low_t>> grid(buckets * buckets);
+	for (size_t i = 0; i < max<size_t>(1, n * n / 50); i++) {
+		const low_t low{rng.range(0, static_cast<long>(n) - 1), rng.range(0, static_cast<long>(n) - 1)};
+		grid[static_cast<size_t>(low.y / bucket_size) * buckets + static_cast<size_t>(low.x / bucket_size)].push_back(low);
+	}
+
+	// distance to the nearest low point and to the next nearest
+	auto nearest = [&](long x, long y) {
+		const long bx = x / bucket_size;
+		const long by = y / bucket_size;
+		double first = numeric_limits<double>::max();
+		double second = numeric_limits<double>::max();
+		for (long gy = max(0L, by - 1); gy <= min<long>(buckets - 1, by + 1); gy++) {
+			for (long gx = max(0L, bx - 1); gx <= min<long>(buckets - 1, bx + 1); gx++) {
+				for (const auto &low : grid[static_cast<size_t>(gy) * buckets + static_cast<size_t>(gx)]) {
+					const double d = hypot(static_cast<double>(low.x - x), static_cast<double>(low.y - y));
+					if (d < first) {
+						second = first;
+						first = d;
+					} else if (d < second) {
+						second = d;
+					}
+				}
+			}
+		}
+		return pair{first, second};
+	};
+
+	string row(n, '0');
+	for (size_t y = 0; y < n; y++) {
+		for (size_t x = 0; x < n; x++) {
+			const auto [first, second] = nearest(static_cast<long>(x), static_cast<long>(y));
+			row[x] = (second - first < 1.0) ? '9' : static_cast<char>('0' + min(8.0, floor(first)));
+		}
+		out << row << "\n";
+	}
+}
+
+/* Day 10: n lines of brackets, about half corrupted and half incomplete */
+void day10(ostream &out, rng_t &rng, size_t n) {
+	const string open = "([{<";
+	const string close = ")]}>";
+
+	for (size_t i = 0; i < n; i++) {
+		const bool corrupt = rng.one_in(2);
+		const size_t length = static_cast<size_t>(rng.range(90, 110));
+
+		string line;
+		string stack;
+		while (line.size() < length) {
+			if (!stack.empty() && rng.one_in(2)) {
+				line.push_back(stack.back());
+				stack.pop_back();
+			} else {
+				const size_t kind = rng.below(4);
+				line.push_back(open[kind]);
+				stack.push_back(close[kind]);
+			}
+		}
+
+		if (corrupt) {
+			// a closer that does not match what is open
+			if (stack.empty()) {
+				line.push_back('(');
+				stack.push_back(')');
+			}
+			char wrong = close[rng.below(4)];
+			while (wrong == stack.back()) {
+				wrong = close[rng.below(4)];
+			}
+			line.push_back(wrong);
+		} else if (stack.empty()) {
+			line.push_back('[');
+		}
+
+		out << line << "\n";
+	}
+}
+
+/* Day 11: n x n octopus energy levels */
+void day11(ostream &out, rng_t &rng, size_t n) {
+	write_digits(out, rng, n, 0, 9);
+}
+
+/* Day 12: n small caves and a big cave for every three. Big caves only
+ * join small ones, two big caves together would loop forever.
+ */
+void day12(ostream &out, rng_t &rng, size_t n) {
+	auto name = [&rng](bool big, set<string> &used) {
+		string cave;
+		do {
+			cave.clear();
+			for (size_t i = 0; i < 2; i++) {
+				cave.push_back(static_cast<char>((big ? 'A' : 'a') + rng.below(26)));
+			}
+		} while (cave == "start" || cave == "end" || !used.insert(cave).second);
+		return cave;
+	};
+
+	set<string> used;
+	vector<string> small;
+	vector<string> big;
+	for (size_t i = 0; i < n; i++) {
+		small.push_back(name(false, used));
+	}
+	for (size_t i = 0; i < max<size_t>(1, n / 3); i++) {
+		big.push_back(name(true, used));
+	}
+
+	set<pair<string, string>> edges;
+	auto join = [&edges](const string &a, const string &b) {
+		if (a != b) {
+			edges.insert(minmax(a, b));
+		}
+	};
+
+	// every small cave next to a big one, so everything is connected
+	for (size_t i = 0; i < small.size(); i++) {
+		join(small[i], big[i % big.size()]);
+	}
+	for (size_t i = 0; i < small.size(); i++) {
+		join(small[i], small[rng.below(small.size())]);
+	}
+	for (const auto &b : big) {
+		join(b, small[rng.below(small.size())]);
+	}
+
+	join("start", big[0]);
+	join("start", small[rng.below(small.size())]);
+	join("end", big[big.size() - 1]);
+	join("end", small[rng.below(small.size())]);
+
+	vector<pair<string, string>> lines{edges.begin(), edges.end()};
+	rng.shuffle(lines);
+	for (auto &[a, b] : lines) {
+		if (rng.one_in(2)) {
+			swap(a, b);
+		}
+		out << a << "-" << b << "\n";
+	}
+}
+
+/* Day 13: n dots that fold down to 40 x 6, none of them on a fold line */
+void day13(ostream &out, rng_t &rng, size_t n) {
+	// folds, innermost last, as they are in the puzzle
+	const vector<pair<char, long>> folds = {
+		{'x', 655}, {'y', 447}, {'x', 327}, {'y', 223}, {'x', 163}, {'y', 111},
+		{'x', 81}, {'y', 55}, {'x', 40}, {'y', 27}, {'y', 13}, {'y', 6}
+	};
+
+	set<pair<long, long>> dots;
+	while (dots.size() < n) {
+		long x = rng.range(0, 39);
+		long y = rng.range(0, 5);
+
+		// unfold, each fold may have had the dot on its far side
+		for (auto fold = folds.rbegin(); fold != folds.rend(); ++fold) {
+			long &v = (fold->first == 'x') ? x : y;
+			if (rng.one_in(2)) {
+				v = 2 * fold->second - v;
+			}
+		}
+		dots.insert({x, y});
+	}
+
+	vector<pair<long, long>> lines{dots.begin(), dots.end()};
+	rng.shuffle(lines);
+	for (const auto &[x, y] : lines) {
+		out << x << "," << y << "\n";
+	}
+
+	out << "\n";
+	for (const auto &[axis, at] : folds) {
+		out << "fold along " << axis << "=" << at << "\n";
+	}
+}
+
+/* Day 14: a template n long and a rule for every pair of ten elements */
+void day14(ostream &out, rng_t &rng, size_t n) {
+	const string elements = "BCFHKNOPSV";
+
+	string polymer(n, 'B');
+	for (auto &c : polymer) {
+		c = elements[rng.below(elements.size())];
+	}
+	out << polymer << "\n\n";
+
+	for (const char a : elements) {
+		for (const char b : elements) {
+			out << a << b << " -> " << elements[rng.below(elements.size())] << "\n";
+		}
+	}
+}
+
+/* Day 15: n x n risk levels */
+void day15(ostream &out, rng_t &rng, size_t n) {
+	write_digits(out, rng, n, 1, 9);
+}
+
+/* Day 16: n transmissions of a couple of hundred packets each */
+struct bits_writer_t {
+	vector<bool> bits{};
+
+	void put(uint64_t value, size_t count) {
+		for (size_t b = count; b-- > 0;) {
+			bits.push_back((value >> b) & 1);
+		}
+	}
+
+	string hex() {
+		while (bits.size() % 4) {
+			bits.push_back(false);
+		}
+
+		string text;
+		for (size_t i = 0; i < bits.size(); i += 4) {
+			const size_t nibble = bits[i] * 8u + bits[i+1] * 4u + bits[i+2] * 2u + bits[i+3] * 1u;
+			text.push_back("0123456789ABCDEF"[nibble]);
+		}
+		return text;
+	}
+};
+
+void packet(bits_writer_t &out, rng_t &rng, size_t depth) {
+	const uint64_t version = rng.below(8);
+
+	if (depth == 0 || rng.one_in(4)) {
+		// literal, up to 4 groups of 4 bits
+		out.put(version, 3);
+		out.put(4, 3);
+		const size_t groups = 1 + rng.below(4);
+		for (size_t g = 0; g < groups; g++) {
+			out.put(g + 1 < groups, 1);
+			out.put(rng.below(16), 4);
+		}
+		return;
+	}
+
+	// sum, product, min, max or (with exactly two sub packets) gt, lt, eq
+	const array<uint64_t, 7> types = {0, 1, 2, 3, 5, 6, 7};
+	const uint64_t type = types[rng.below(types.size())];
+	const size_t subs = (type >= 5) ? 2 : ((type == 1) ? 1 + rng.below(3) : 1 + rng.below(5));
+
+	out.put(version, 3);
+	out.put(type, 3);
+
+	bits_writer_t inner{};
+	for (size_t s = 0; s < subs; s++) {
+		packet(inner, rng, depth - 1);
+	}
+
+	if (rng.one_in(2) && inner.bits.size() < (1u << 15)) {
+		out.put(0, 1);
+		out.put(inner.bits.size(), 15);
+	} else {
+		out.put(1, 1);
+		out.put(subs, 11);
+	}
+	out.bits.insert(out.bits.end(), inner.bits.begin(), inner.bits.end());
+}
+
+void day16(ostream &out, rng_t &rng, size_t n) {
+	for (size_t i = 0; i < n; i++) {
+		bits_writer_t bits{};
+		do {
+			bits.bits.clear();
+			packet(bits, rng, 6);
+		} while (bits.bits.size() < 1000);	// a few hundred packets, not a lone literal
+		out << bits.hex() << "\n";
+	}
+}
+
+/* Day 17: n target areas, ahead and below the probe */
+void day17(ostream &out, rng_t &rng, size_t n) {
+	for (size_t i = 0; i < n; i++) {
+		const long x = rng.range(20, 250);
+		const long y = rng.range(-200, -20);
+		out << "target area: x=" << x << ".." << x + rng.range(10, 40)
+			<< ", y=" << y << ".." << y + rng.range(5, 19) << "\n";
+	}
+}
+
+/* Day 18: n snailfish numbers, already reduced; nothing nested in four
+ * pairs and every regular number below 10.
+ */
+string snailfish(rng_t &rng, size_t depth) {
+	auto element = [&rng, depth]() {
+		if (depth < 4 && !rng.one_in(3)) {
+			return snailfish(rng, depth + 1);
+		}
+		return to_string(rng.below(10));
+	};
+
+	const string left = element();
+	const string right = element();
+	return "[" + left + "," + right + "]";
+}
+
+void day18(ostream &out, rng_t &rng, size_t n) {
+	for (size_t i = 0; i < n; i++) {
+		out << snailfish(rng, 1) << "\n";
+	}
+}
+
+/* Day 19: n scanners along a random walk, each one within reach of the
+ * last and sharing at least 12 beacons with it. Each reports the beacons
+ * within 1000 on every axis, in its own one of the 24 orientations.
+ */
+using coord_t = array<long, 3>;
+
+void day19(ostream &out, rng_t &rng, size_t n) {
+	const long reach = 1000;
+
+	// the 24 rotations; rows of each matrix, a permutation of the axes with signs
+	vector<array<coord_t, 3>> rotations;
+	array<size_t, 3> axes = {0, 1, 2};
+	do {
+		const bool odd = (axes == array<size_t, 3>{0, 2, 1} || axes == array<size_t, 3>{1, 0, 2}
+			|| axes == array<size_t, 3>{2, 1, 0});
+		for (size_t signs = 0; signs < 8; signs++) {
+			const bool negative = ((signs & 1) ^ ((signs >> 1) & 1) ^ ((signs >> 2) & 1)) != 0;
+			if (negative != odd) {
+				continue;	// a reflection
+			}
+
+			array<coord_t, 3> m{};
+			for (size_t r = 0; r < 3; r++) {
+				m[r][axes[r]] = ((signs >> r) & 1) ? -1 : 1;
+			}
+			rotations.push_back(m);
+		}
+	} while (next_permutation(axes.begin(), axes.end()));
+
+	vector<coord_t> scanners = {{0, 0, 0}};
+	for (size_t i = 1; i < n; i++) {
+		coord_t next = scanners.back();
+		const size_t axis = rng.below(3);
+		for (size_t a = 0; a < 3; a++) {
+			next[a] += (a == axis) ? (rng.one_in(2) ? 1 : -1) * rng.range(1000, 1200) : rng.range(-150, 150);
+		}
+		scanners.push_back(next);
+	}
+
+	auto sees = [reach](const coord_t &scanner, const coord_t &beacon) {
+		for (size_t a = 0; a < 3; a++) {
+			if (beacon[a] < scanner[a] - reach || beacon[a] > scanner[a] + reach) {
+				return false;
+			}
+		}
+		return true;
+	};
+
+	set<coord_t> beacons;
+	for (size_t i = 0; i < n; i++) {
+		// some of its own
+		for (size_t b = 0; b < 10; b++) {
+			coord_t beacon;
+			for (size_t a = 0; a < 3; a++) {
+				beacon[a] = scanners[i][a] + rng.range(-reach, reach);
+			}
+			beacons.insert(beacon);
+		}
+
+		// and some it shares with the one before
+		if (i > 0) {
+			const coord_t &other = scanners[i-1];
+			coord_t low, high;
+			for (size_t a = 0; a < 3; a++) {
+				low[a] = max(scanners[i][a], other[a]) - reach;
+				high[a] = min(scanners[i][a], other[a]) + reach;
+			}
+			// 14 new ones, so 12 are there even if others land on them
+			for (size_t b = 0; b < 14; ) {
+				coord_t beacon;
+				for (size_t a = 0; a < 3; a++) {
+					beacon[a] = rng.range(low[a], high[a]);
+				}
+				if (beacons.insert(beacon).second) {
+					b++;
+				}
+			}
+		}
+	}
+
+	for (size_t i = 0; i < n; i++) {
+		const auto &m = rotations[i ? rng.below(rotations.size()) : 0];
+
+		vector<coord_t> seen;
+		for (const auto &beacon : beacons) {
+			if (sees(scanners[i], beacon)) {
+				coord_t d, r;
+				for (size_t a = 0; a < 3; a++) {
+					d[a] = beacon[a] - scanners[i][a];
+				}
+				for (size_t a = 0; a < 3; a++) {
+					r[a] = m[a][0] * d[0] + m[a][1] * d[1] + m[a][2] * d[2];
+				}
+				seen.push_back(r);
+			}
+		}
+		rng.shuffle(seen);
+
+		out << (i ? "\n" : "") << "--- scanner " << i << " ---\n";
+		for (const auto &b : seen) {
+			out << b[0] << "," << b[1] << "," << b[2] << "\n";
+		}
+	}
+}
+
+/* Day 20: a 512 character algorithm and an n x n image. Like the real
+ * inputs the algorithm lights the dark infinity (first '#') and darkens it
+ * again (last '.'), the solution counts on it.
+ */
+void day20(ostream &out, rng_t &rng, size_t n) {
+	string algorithm(512, '.');
+	for (auto &c : algorithm) {
+		c = rng.one_in(2) ? '#' : '.';
+	}
+	algorithm.front() = '#';
+	algorithm.back() = '.';
+	out << algorithm << "\n\n";
+
+	string row(n, '.');
+	for (size_t y = 0; y < n; y++) {
+		for (auto &c : row) {
+			c = rng.one_in(2) ? '#' : '.';
+		}
+		out << row << "\n";
+	}
+}
+
+/* Day 21: two starting positions, nothing to scale */
+void day21(ostream &out, rng_t &rng, [[maybe_unused]] size_t n) {
+	out << "Player 1 starting position: " << rng.range(1, 10) << "\n";
+	out << "Player 2 starting position: " << rng.range(1, 10) << "\n";
+}
+
+/* Day 22: n reboot steps; the first 20 inside -50..50 like the puzzle,
+ * the rest anywhere in -100000..100000
+ */
+void day22(ostream &out, rng_t &rng, size_t n) {
+	for (size_t i = 0; i < n; i++) {
+		const bool initialization = i < 20;
+		const long limit = initialization ? 50 : 100000;
+		const long size = initialization ? 40 : 30000;
+		const bool on = initialization ? !rng.one_in(5) : !rng.one_in(3);
+
+		out << (on ? "on" : "off");
+		for (size_t a = 0; a < 3; a++) {
+			const long low = rng.range(-limit, limit - size);
+			out << (a ? "," : " ") << "xyz"[a] << "=" << low << ".." << low + rng.range(1, size);
+		}
+		out << "\n";
+	}
+}
+
+/* Day 23: n of each amphipod in rooms n deep. Shuffled rooms that deep
+ * mostly have no way to sort them out, so this plays backwards from
+ * everyone home; out of a room with only its own in it to the hallway,
+ * and from the hallway onto any room not full, until it has made enough
+ * moves (or can make none) and nobody is in the hallway. Each of those
+ * is a move the puzzle allows forwards, so there is always a way home.
+ * The solution fits rooms 7 deep at most, and only unfolds part 2 for
+ * the usual 2.
+ */
+void day23(ostream &out, rng_t &rng, size_t n) {
+	const array<size_t, 7> stops = {0, 1, 3, 5, 7, 9, 10};
+	const string empty_hallway(11, '.');
+
+	string hallway = empty_hallway;
+	vector<string> rooms;		// bottom up
+	for (char c : string("ABCD")) {
+		rooms.push_back(string(n, c));
+	}
+
+	// nobody between the stop and the room, the stop itself not counted
+	auto clear = [&](size_t stop, size_t room) {
+		const size_t entry = 2 * room + 2;
+		for (size_t i = min(stop, entry); i <= max(stop, entry); i++) {
+			if (i != stop && hallway[i] != '.') {
+				return false;
+			}
+		}
+		return true;
+	};
+
+	for (size_t moves = 0; moves < 40 * n || hallway != empty_hallway; moves++) {
+		vector<pair<size_t, size_t>> outs, ins;		// {stop, room}
+		for (auto stop : stops) {
+			for (size_t room = 0; room < 4; room++) {
+				if (!clear(stop, room)) {
+					continue;
+				}
+
+				const string &in_room = rooms[room];
+				if (hallway[stop] != '.') {
+					if (in_room.size() < n) {
+						ins.push_back({stop, room});
+					}
+				} else if (!in_room.empty() && in_room.find_first_not_of(static_cast<char>('A' + room)) == string::npos) {
+					outs.push_back({stop, room});
+				}
+			}
+		}
+
+		// there is always somewhere to go in while anyone is out, with
+		// nobody out and no room to come out of it is as mixed up as it gets
+		if (ins.empty() && outs.empty()) {
+			break;
+		}
+
+		if (!ins.empty() && (moves >= 40 * n || outs.empty() || rng.one_in(4))) {
+			const auto [stop, room] = ins[rng.below(ins.size())];
+			rooms[room].push_back(hallway[stop]);
+			hallway[stop] = '.';
+		} else {
+			const auto [stop, room] = outs[rng.below(outs.size())];
+			hallway[stop] = rooms[room].back();
+			rooms[room].pop_back();
+		}
+	}
+
+	out << "#############\n";
+	out << "#...........#\n";
+	for (size_t row = 0; row < n; row++) {
+		out << (row ? "  #" : "###");
+		for (size_t room = 0; room < 4; room++) {
+			out << rooms[room][n - 1 - row] << "#";
+		}
+		out << (row ? "\n" : "##\n");
+	}
+	out << "  #########\n";
+}
+
+struct generator_t {
+	int day;
+	void (*write)(ostream &, rng_t &, size_t);
+	size_t default_scale;
+	const char *scale_is;
+	size_t max_scale = 0;			// 0 is no limit
+	const char *limit_is = nullptr;	// why the limit, or what happens past the default
+};
+
+const vector<generator_t> generators = {
+	{1, day1, 2000, "depths"},
+	{2, day2, 1000, "commands"},
+	{3, day3, 1000, "numbers"},
+	{4, day4, 100, "boards"},
+	{5, day5, 500, "lines"},
+	{6, day6, 300, "fish"},
+	{7, day7, 1000, "crabs"},
+	{8, day8, 200, "displays"},
+	{9, day9, 100, "map width and height"},
+	{10, day10, 100, "lines"},
+	{11, day11, 10, "grid width and height", 0, "random grids seldom all flash at once, part 2 may never end"},
+	{12, day12, 6, "small caves", 60, "small caves are bits in a uint64_t"},
+	{13, day13, 800, "dots"},
+	{14, day14, 20, "template length"},
+	{15, day15, 100, "map width and height"},
+	{16, day16, 1, "transmissions"},
+	{17, day17, 1, "target areas"},
+	{18, day18, 100, "snailfish numbers"},
+	{19, day19, 25, "scanners", 0, "time and memory grow with the square of the beacons"},
+	{20, day20, 100, "image width and height"},
+	{21, day21, 1, "(nothing)"},
+	{22, day22, 420, "reboot steps"},
+	{23, day23, 2, "room depth", 7, "the burrow packs 42 cells, the hallway and 4 rooms 7 deep"},
+};
+
+// the days that do not scale freely and why
+void list_limits(ostream &out) {
+	for (const auto &g : generators) {
+		if (g.limit_is) {
+			out << "  day" << setw(2) << left << g.day << right << "  ";
+			if (g.max_scale) {
+				out << "at most " << g.max_scale << ", ";
+			}
+			out << g.limit_is << endl;
+		}
+	}
+}
+
+void usage(const char *program) {
+	cerr << "usage: " << program << " [-s seed] [-n scale] [-o file] day" << endl;
+	cerr << "       " << program << " -l" << endl;
+	cerr << "scale limits:" << endl;
+	list_limits(cerr);
+	exit(1);
+}
+
+int main(int argc, char *argv[]) {
+	string output;
+
+	int opt;
+	while ((opt = getopt(argc, argv, "s:n:o:l")) != -1) {
+		switch (opt) {
+			case 's':
+				seed = strtoull(optarg, nullptr, 10);
+				break;
+			case 'n':
+				scale = strtoull(optarg, nullptr, 10);
+				break;
+			case 'o':
+				output = optarg;
+				break;
+			case 'l':
+				for (const auto &g : generators) {
+					cout << "day" << setw(2) << left << g.day << right
+						<< setw(8) << g.default_scale << "  " << g.scale_is << endl;
+				}
+				cout << endl << "scale limits:" << endl;
+				list_limits(cout);
+				return 0;
+			default:
+				usage(argv[0]);
+		}
+	}
+
+	if (optind >= argc) {
+		usage(argv[0]);
+	}
+
+	string day_arg = argv[optind];
+	if (day_arg.starts_with("day")) {
+		day_arg = day_arg.substr(3);
+	}
+	const int day = atoi(day_arg.c_str());
+
+	auto g = find_if(generators.begin(), generators.end(), [day](const generator_t &g) {
+		return g.day == day;
+	});
+	if (g == generators.end()) {
+		cerr << "no generator for day " << day_arg << endl;
+		return 1;
+	}
+
+	// the day in the seed, so each day has its own numbers
+	rng_t rng(seed * 100 + static_cast<uint64_t>(day));
+	const size_t n = scale ? scale : g->default_scale;
+	if (g->max_scale && n > g->max_scale) {
+		cerr << "day" << day << " scale is at most " << g->max_scale
+			<< ", " << g->limit_is << endl;
+		return 1;
+	}
+
+	if (output.empty()) {
+		g->write(cout, rng, n);
+	} else {
+		std::ofstream ofs(output);
+		g->write(ofs, rng, n);
+	}
+}
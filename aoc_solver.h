@@ -0,0 +1,66 @@
+#if !defined(AOC_SOLVER_H)
+#define AOC_SOLVER_H
+
+#include <string>		// std::string
+#include <type_traits>	// std::remove_cvref_t, std::invoke_result_t
+
+/* A day's solution as libaoc (aoc.h) hands it out.
+ *
+ * Every day is also built into libaoc (see the top level CMakeLists.txt)
+ * with AOC_SOLVER and AOC_DAY defined. The days all have a read_data,
+ * part1 and part2 of their own, so everything a day defines but
+ * aoc_solver() is hidden and made local to the day before it is linked
+ * in; what they share from common/ is in the library once. The parsed
+ * input is opaque here, parse() hands one out and release() takes it back.
+ */
+struct aoc_solver_t {
+	int day = 0;
+	void *(*parse)(const std::string &filename) = nullptr;
+	std::string (*part1)(const void *data) = nullptr;
+	std::string (*part2)(const void *data) = nullptr;
+	void (*release)(void *data) = nullptr;
+};
+
+#define AOC_EXPORT extern "C" __attribute__((visibility("default")))
+
+// answers are strings on some days and numbers on others
+template <typename T>
+std::string aoc_answer(const T &result) {
+	if constexpr (std::is_convertible_v<T, std::string>) {
+		return result;
+	} else {
+		return std::to_string(result);
+	}
+}
+
+/* The solver for the day's own read_data, part1 and part2, used at the
+ * bottom of solution.cpp:
+ *
+ *	AOC_EXPORT const aoc_solver_t *aoc_solver() {
+ *		return make_solver<read_data, part1, part2>(AOC_DAY);
+ *	}
+ */
+template <auto Read, auto Part1, auto Part2>
+const aoc_solver_t *make_solver(int day) {
+	using data_t = std::remove_cvref_t<std::invoke_result_t<decltype(Read), const std::string &>>;
+
+	static const aoc_solver_t solver{
+		day,
+		[](const std::string &filename) -> void * {
+			return new data_t(Read(filename));
+		},
+		[](const void *data) {
+			return aoc_answer(Part1(*static_cast<const data_t *>(data)));
+		},
+		[](const void *data) {
+			return aoc_answer(Part2(*static_cast<const data_t *>(data)));
+		},
+		[](void *data) {
+			delete static_cast<data_t *>(data);
+		},
+	};
+
+	return &solver;
+}
+
+#endif
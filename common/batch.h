@@ -0,0 +1,202 @@
+#if !defined(BATCH_H)
+#define BATCH_H
+
+#include <chrono>		// high resolution timer
+#include <iostream>		// cout, cerr
+#include <sstream>		// ostringstream
+#include <string>		// std::string
+#include <vector>		// std::vector
+#include <algorithm>	// sort
+#include <atomic>		// std::atomic
+#include <mutex>		// std::mutex
+#include <thread>		// std::jthread
+#include <exception>	// std::exception
+#include <filesystem>	// directories of inputs
+#include <functional>	// std::function
+#include <initializer_list>	// day flags
+#include <cstdlib>		// atoi
+#include <unistd.h>		// getopt
+
+#include "report.h"
+
+/* Batch mode, many inputs solved at once in one process:
+ *
+ *	day15 -j 8 inputs/ extra.txt
+ *
+ * Directories stand for the regular files in them (not below them),
+ * sorted by name. jobs threads each take the next input not yet started
+ * until none are left, so a slow input only holds up its own thread. Each
+ * input's report goes to a buffer and is written out whole as the input
+ * finishes, in the order they finish, not the order given.
+ *
+ * text  the input name, then the usual lines for it; at the end how many
+ *       inputs and the wall time for all of them
+ * json  one object a line, "input" says which
+ * csv   the header once, then a row per input
+ *
+ * The phase timings are each input's own, but the threads share the
+ * allocation counters in report.h, so with more than one job the allocs
+ * and bytes of an input include whatever the others did meanwhile.
+ */
+
+// the inputs named on the command line, directories opened up
+inline std::vector<std::string> batch_inputs(const std::vector<std::string> &names) {
+	std::vector<std::string> inputs;
+
+	for (const auto &name : names) {
+		if (std::filesystem::is_directory(name)) {
+			std::vector<std::string> files;
+			for (const auto &entry : std::filesystem::directory_iterator(name)) {
+				if (entry.is_regular_file()) {
+					files.push_back(entry.path().string());
+				}
+			}
+			std::sort(files.begin(), files.end());
+			inputs.insert(inputs.end(), files.begin(), files.end());
+		} else {
+			inputs.push_back(name);
+		}
+	}
+
+	return inputs;
+}
+
+// more than one input, or a directory of them
+inline bool is_batch(const std::vector<std::string> &names) {
+	return names.size() > 1 || (names.size() == 1 && std::filesystem::is_directory(names[0]));
+}
+
+// the threads to use when not told, one for each core
+inline unsigned batch_jobs(unsigned jobs) {
+	return jobs ? jobs : std::max(1u, std::thread::hardware_concurrency());
+}
+
+// read one input and solve both parts, reporting each phase
+template <auto Read, auto Part1, auto Part2>
+void solve_input(report_t &report, const std::string &input) {
+	auto data = Read(input);
+	report.parsed();
+
+	auto p1_result = Part1(data);
+	report.part("part1", p1_result);
+
+	auto p2_result = Part2(data);
+	report.part("part2", p2_result);
+
+	report.done();
+}
+
+/* Solve every input with the day's own read_data, part1 and part2 (the
+ * same three aoc_solver.h takes). Returns the exit status for main(),
+ * 1 when any input threw.
+ */
+template <auto Read, auto Part1, auto Part2>
+int run_batch(report_format_t format, const std::vector<std::string> &names, unsigned jobs) {
+	using clock = std::chrono::high_resolution_clock;
+
+	const std::vector<std::string> inputs = batch_inputs(names);
+	const auto start = clock::now();
+
+	std::atomic<size_t> next{0};
+	std::atomic<int> failed{0};
+	std::mutex output;
+	bool header = (format == report_format_t::csv);
+
+	auto worker = [&]() {
+		for (size_t i = next++; i < inputs.size(); i = next++) {
+			std::ostringstream buffer;
+			if (format == report_format_t::text) {
+				buffer << inputs[i] << std::endl;
+			}
+
+			report_t report(format, inputs[i], buffer);
+			report.header = false;
+			try {
+				solve_input<Read, Part1, Part2>(report, inputs[i]);
+			} catch (const std::exception &e) {
+				const std::lock_guard<std::mutex> lock(output);
+				std::cerr << inputs[i] << ": " << e.what() << std::endl;
+				failed++;
+				continue;
+			}
+
+			const std::lock_guard<std::mutex> lock(output);
+			if (header) {
+				report.csv_header(std::cout);
+				header = false;
+			}
+			std::cout << buffer.str() << std::flush;
+		}
+	};
+
+	{
+		std::vector<std::jthread> threads;
+		for (unsigned t = 0; t < std::min<size_t>(batch_jobs(jobs), inputs.size()); t++) {
+			threads.emplace_back(worker);
+		}
+	}
+
+	if (format == report_format_t::text) {
+		print_result(std::to_string(inputs.size()) + " inputs", clock::now() - start);
+	}
+
+	return failed ? 1 : 0;
+}
+
+// a flag of a day's own, like day15's -v; set is called each time it is given
+struct day_flag_t {
+	char flag;
+	std::function<void()> set;
+};
+
+/* main() for every day:
+ *
+ *	dayN [flags] [-o text|json|csv] [-j jobs] [input_file | dir...]
+ *
+ * One input (test.txt when none is given) is solved and reported as it
+ * goes; with -j or more than one input it is run_batch(). Returns the
+ * exit status for main().
+ */
+template <auto Read, auto Part1, auto Part2>
+int day_main(int argc, char *argv[], std::initializer_list<day_flag_t> flags = {}) {
+	report_format_t format = report_format_t::text;
+	unsigned jobs = 0;
+
+	std::string optstring;
+	std::string usage;
+	for (const auto &f : flags) {
+		optstring += f.flag;
+		usage += std::string(" [-") + f.flag + "]";
+	}
+	optstring += "o:j:";
+
+	int opt;
+	while ((opt = getopt(argc, argv, optstring.c_str())) != -1) {
+		const auto f = std::find_if(flags.begin(), flags.end(),
+			[opt](const day_flag_t &candidate) { return candidate.flag == opt; });
+
+		if (f != flags.end()) {
+			f->set();
+		} else if (opt == 'o') {
+			format = report_format(optarg);
+		} else if (opt == 'j') {
+			jobs = static_cast<unsigned>(std::max(1, atoi(optarg)));
+		} else {
+			std::cerr << "usage: " << argv[0] << usage << " [-o text|json|csv] [-j jobs] [input_file | dir...]" << std::endl;
+			return 1;
+		}
+	}
+
+	// several inputs at once
+	const std::vector<std::string> inputs(argv + optind, argv + argc);
+	if (jobs || is_batch(inputs)) {
+		return run_batch<Read, Part1, Part2>(format, inputs, jobs);
+	}
+
+	const std::string input_file = inputs.empty() ? "test.txt" : inputs[0];
+	report_t report(format, input_file);
+	solve_input<Read, Part1, Part2>(report, input_file);
+	return 0;
+}
+
+#endif
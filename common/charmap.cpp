@@ -31,7 +31,7 @@ std::ostream& operator<<(std::ostream& os, const charmap_t &map) {
 	for (auto y = ymin; y < ymax; y++) {
 		os << y % 10 << "| ";
 
-		auto row = map.data[static_cast<size_t>(y)];
+		auto row = map.row(y);
 		for (auto xit = row.begin(); xit != row.end(); ++xit) {
 			if (strchr(highlight_chars, *xit) == NULL) {
 				os << *xit;
@@ -0,0 +1,441 @@
+#if !defined(CHARMAP_T_H)
+#define CHARMAP_T_H
+
+#include <string>		// std::string
+#include <vector>		// std::vector
+#include <string_view>	// std::string_view
+#include <algorithm>	// std::fill, std::copy_n
+#include <functional>	// std::function
+#include <ranges>		// std::flat_map
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <array>
+#include <cassert>		// assert macro
+
+#include "point.h"
+#include "input_view.h"
+
+struct charmap_t {
+	dimension_t size_x = 0;
+	dimension_t size_y = 0;
+	// size_t show_context = 0;
+
+	/* Row-major single buffer, each row padded out to stride chars so
+	 * rows start aligned and (x, y) is data[origin + y * stride + x].
+	 * Cells past the end of a short (ragged) row read as sentinel ('\0').
+	 *
+	 * add_border() frames the map in a one cell halo of sentinel, so
+	 * get_unchecked(), neighbors4() and neighbors8() can read one step
+	 * outside the map without bounds checks. */
+	static constexpr dimension_t row_align = 16;
+	dimension_t stride = 0;
+	dimension_t border = 0;
+	char sentinel = '\0';
+	std::vector<char> data = {};
+
+	charmap_t() {
+	}
+
+	// empty of size_x x size_y, the padding past size_x is sentinel like
+	// any other row's so row_width() and fill_ragged() see size_x cells
+	template <std::convertible_to<dimension_t> Tx, std::convertible_to<dimension_t> Ty>
+	charmap_t(Tx size_x, Ty size_y, char fill = '\0') :
+		size_x(static_cast<dimension_t>(size_x)),
+		size_y(static_cast<dimension_t>(size_y)),
+		stride(align_stride(static_cast<dimension_t>(size_x))),
+		data(static_cast<size_t>(stride * this->size_y), sentinel) {
+		for (dimension_t y = 0; y < this->size_y; y++) {
+			std::fill_n(this->row_begin(y), this->size_x, fill);
+		}
+	}
+
+	// one row per line of text, e.g. input_view_t::text() or a section of it
+	explicit charmap_t(std::string_view text) {
+		for (const auto line : split_view_t(text, "\n", true)) {
+			this->add_row(line.data(), line.size());
+		}
+	}
+
+	explicit charmap_t(const input_view_t &input) : charmap_t(input.text()) {
+	}
+
+	void add_line(const std::string &line) {
+		this->add_row(line.data(), line.size());
+	}
+
+	void add_line(const std::vector<char> &line) {
+		this->add_row(line.data(), line.size());
+	}
+
+	void add_line(const char ch = '.') {
+		std::fill_n(this->append_row(), this->size_x, ch);
+	}
+
+	/* Surround the map with a one cell halo of sentinel chars. 
+	 * Call once the map is loaded and fill_ragged() has run; only size_x
+	 * cells of each row are kept, the rest of the frame is sentinel. */
+	void add_border(const char sentinel) {
+		const dimension_t framed_stride = align_stride(this->size_x + 2);
+		std::vector<char> framed(static_cast<size_t>(framed_stride * (this->size_y + 2)), sentinel);
+		for (dimension_t y = 0; y < this->size_y; y++) {
+			std::copy_n(this->row_begin(y), this->size_x, 
+						framed.data() + (y + 1) * framed_stride + 1);
+		}
+
+		this->data = std::move(framed);
+		this->stride = framed_stride;
+		this->border = 1;
+		this->sentinel = sentinel;
+	}
+
+	void fill_ragged(const char filler_ch = ' ') {
+		// if the map has ragged x edges (on the right)
+		// fill them in with empty space to make the map rectangle
+
+		// find max_x; max width row
+		dimension_t max_x = 0;
+		for (dimension_t y = 0; y < this->size_y; y++) {
+			max_x = std::max(max_x, this->row_width(y));
+		}
+
+		// fill with filler_ch
+		for (dimension_t y = 0; y < this->size_y; y++) {
+			char *row = this->row_begin(y);
+			std::fill(row + this->row_width(y), row + max_x, filler_ch);
+		}
+
+		// update the xsize_x of the map
+		this->size_x = max_x;
+	}
+	
+	template <std::convertible_to<dimension_t> Tx, std::convertible_to<dimension_t> Ty>
+	bool is_valid(const Tx x, const Ty y) const {
+		dimension_t native_x = static_cast<dimension_t>(x);
+		dimension_t native_y = static_cast<dimension_t>(y);
+		return 0 <= native_x && native_x < this->size_x 
+			&& 0 <= native_y && native_y < this->size_y;
+	}
+
+	bool is_valid(const point_t &p) const {
+		return is_valid(p.x, p.y);
+	}
+
+	template <std::convertible_to<dimension_t> Tx, std::convertible_to<dimension_t> Ty>
+	char get(const Tx x, const Ty y, const char invalid = '\0') const {
+		return this->is_valid(x, y) ? data[this->index_of(x, y)] : invalid;
+	}
+
+	char get(const point_t &p, const char invalid = '\0') const {
+		return this->get(p.x, p.y, invalid);
+	}
+
+	template <std::convertible_to<dimension_t> Tx, std::convertible_to<dimension_t> Ty, 
+				std::convertible_to<char> Tc>
+	void set(const Tx x, const Ty y, const Tc c) {
+		if (this->is_valid(x, y)) {
+			this->data[this->index_of(x, y)] = static_cast<char>(c);
+		}
+	}
+
+	template <std::convertible_to<char> Tc>
+	void set(const point_t &p, const Tc c) {
+		if (this->is_valid(p)) {
+			this->set(p.x, p.y, c);
+		}
+	}
+
+	// offset of (x, y) in data, no bounds checking
+	template <std::convertible_to<dimension_t> Tx, std::convertible_to<dimension_t> Ty>
+	size_t index_of(const Tx x, const Ty y) const {
+		return static_cast<size_t>(this->origin()
+								 + static_cast<dimension_t>(y) * this->stride
+								 + static_cast<dimension_t>(x));
+	}
+
+	size_t index_of(const point_t &p) const {
+		return this->index_of(p.x, p.y);
+	}
+
+	// inverse of index_of, for cells on the map
+	point_t point_of(const size_t index) const {
+		const dimension_t offset = static_cast<dimension_t>(index) - this->origin();
+		return {offset % this->stride, offset / this->stride};
+	}
+
+	// the size_x visible chars of row y
+	std::string_view row(const dimension_t y) const {
+		return {this->row_begin(y), static_cast<size_t>(this->size_x)};
+	}
+
+	/* No bounds checking; points one step outside the map are only
+	 * safe to read or write after add_border(), which it asserts. */
+	char get_unchecked(const point_t &p) const {
+		assert(this->border);
+		return this->data[this->index_of(p)];
+	}
+
+	template <std::convertible_to<char> Tc>
+	void set_unchecked(const point_t &p, const Tc c) {
+		this->data[this->index_of(p)] = static_cast<char>(c);
+	}
+
+	template <std::convertible_to<dimension_t> Tx, std::convertible_to<dimension_t> Ty>
+	bool is_char(const Tx x, const Ty y, const char c) const {
+		return this->get(x, y) == c;
+	}
+
+	bool is_char(const point_t &p, const char c) const {
+		return this->get(p) == c;
+	}
+
+	template <std::convertible_to<dimension_t> Tx, std::convertible_to<dimension_t> Ty>
+	bool is_not_char(const Tx x, const Ty y, const char c) const {
+		return !this->is_char(x, y, c);
+	}
+
+	bool is_not_char(const point_t &p, char c) const {
+		return !this->is_char(p, c);
+	}
+
+	// std::views iterator for all x,y with character
+	auto all_xy() const {
+        return std::views::iota(0u, static_cast<size_t>(size_y)) |
+               std::views::transform([this](size_t y) {
+                   return std::views::iota(0u, static_cast<size_t>(size_x)) |
+                          std::views::transform([this, y](size_t x) {
+                              return std::tuple<size_t, size_t, char>(x, y, data[index_of(x, y)]);
+                          });
+               }) |
+			   std::views::join;
+    }
+
+	std::vector<point_t> _directions{{0, -1}, {1, 0}, {0, 1}, {-1, 0}};
+	auto neighbors_of(const point_t &p) const {
+		return _directions |
+			std::views::filter([this, &p](const point_t &direction) {
+				return this->is_valid(p+direction);
+			}) |
+			std::views::transform([this, &p](const point_t &direction) {
+				return std::pair<point_t, char>(p+direction, this->get(p+direction));
+			});
+	}
+
+	/* Neighbors of p in _directions order, without the is_valid filter.
+	 * Requires add_border(); off-map neighbors come back as sentinel. */
+	std::array<std::pair<point_t, char>, 4> neighbors4(const point_t &p) const {
+		assert(this->border);
+		const char *c = this->data.data() + this->index_of(p);
+		return {{
+			{{p.x, p.y - 1}, c[-this->stride]},
+			{{p.x + 1, p.y}, c[1]},
+			{{p.x, p.y + 1}, c[this->stride]},
+			{{p.x - 1, p.y}, c[-1]},
+		}};
+	}
+
+	// as neighbors4, including diagonals; row by row from top left
+	std::array<std::pair<point_t, char>, 8> neighbors8(const point_t &p) const {
+		assert(this->border);
+		const char *c = this->data.data() + this->index_of(p);
+		const dimension_t s = this->stride;
+		return {{
+			{{p.x - 1, p.y - 1}, c[-s - 1]}, {{p.x, p.y - 1}, c[-s]}, {{p.x + 1, p.y - 1}, c[-s + 1]},
+			{{p.x - 1, p.y    }, c[    -1]},                          {{p.x + 1, p.y    }, c[     1]},
+			{{p.x - 1, p.y + 1}, c[ s - 1]}, {{p.x, p.y + 1}, c[ s]}, {{p.x + 1, p.y + 1}, c[ s + 1]},
+		}};
+	}
+
+	// std::views iterator for all points, w is the character there
+ 	 auto all_points() const {
+        return std::views::iota(0u, static_cast<size_t>(this->size_y)) |
+               std::views::transform([this](size_t y) {
+                   return std::views::iota(0u, static_cast<size_t>(this->size_x)) |
+                          std::views::transform([this, y](size_t x) {
+								return valued_point_t<point_t, char>{point_t(x, y), this->data[this->index_of(x, y)]};
+                              //return std::pair<point_t, char>({x, y}, this->data[y][x]);
+                          });
+               }) | 
+			   std::views::join;
+    }
+
+	/* Iterate/Enumerate over all the points in the map
+	 * spits out a pair<point_t, char> for each.
+	 */
+	class iterator {
+		private:
+			dimension_t i;
+			const charmap_t &map;
+
+		public:
+			iterator(dimension_t start, const charmap_t &m) : i(start), map(m) {}
+			std::pair<point_t, char> operator*() { 
+				dimension_t x = i % map.size_x;
+				dimension_t y = i / map.size_x;
+				return {{x, y}, map.get(x, y)};
+			}
+			iterator &operator++() { ++i; return *this; }
+			bool operator!=(const iterator &other) const { return i != other.i; }
+	};
+
+	iterator begin() const { return iterator(0, *this); }
+    iterator end() const { return iterator(this->size_x * this->size_y, *this); }
+
+	point_t find_char(const char c = '^') const {
+		for (dimension_t y = 0; y < this->size_y; y++) {
+			for (dimension_t x = 0; x < this->size_x; x++) {
+				if (this->is_char(x, y, c)) {
+					return {x, y};
+				}
+			}
+		}
+
+		return {0, 0};
+	}
+
+	static charmap_t from_vector(const std::vector<std::string> &lines) {
+		charmap_t map;
+
+		for (const auto& line : lines) {
+			map.add_line(line);
+		}
+
+		return map;
+	}
+
+	static charmap_t from_stream(std::ifstream &infile) {
+		charmap_t map;
+
+		for (std::string line; std::getline(infile, line); ) {
+			map.add_line(line);
+		}
+
+		return map;
+	}
+
+	static charmap_t from_file(const std::string &file_name) {
+		input_view_t input(file_name);
+		return charmap_t(input);
+	}
+
+	// TODO: How to limit this type to iterable types; vector, set, etc.
+	template <typename T>
+	static charmap_t from_points(const T &points, const char marker = '#', const char filler = '.') {
+		auto bounding_box = [](const T &points) -> std::pair<point_t, point_t> {
+			point_t min_p{*(points.begin())};
+			point_t max_p{*(points.begin())};
+			for (const auto &p : points) {
+				min_p.x = std::min(min_p.x, p.x);
+				min_p.y = std::min(min_p.y, p.y);
+		
+				max_p.x = std::max(max_p.x, p.x+1);
+				max_p.y = std::max(max_p.y, p.y+1);
+			}
+		
+			return {min_p, max_p};
+		};
+		
+		const auto &[min, max] = bounding_box(points);
+
+		const dimension_t dx = max.x > min.x ? max.x - min.x : min.x - max.x;
+		const dimension_t dy = max.y > min.y ? max.y - min.y : min.y - max.y;
+		charmap_t map(dx, dy, filler);
+
+		for (const auto &point : points) {
+			map.set(point, marker);
+		}
+
+		return map;
+	}
+
+	friend struct std::formatter<charmap_t>;
+
+	private:
+		static dimension_t align_stride(const dimension_t width) {
+			return (width + row_align - 1) / row_align * row_align;
+		}
+
+		// offset of (0, 0) in data, past the halo when there is one
+		dimension_t origin() const {
+			return this->border * this->stride + this->border;
+		}
+
+		char *row_begin(const dimension_t y) {
+			return this->data.data() + this->origin() + y * this->stride;
+		}
+
+		const char *row_begin(const dimension_t y) const {
+			return this->data.data() + this->origin() + y * this->stride;
+		}
+
+		// grow by one (sentinel filled) row, returns the start of it
+		char *append_row() {
+			this->data.resize(this->data.size() + static_cast<size_t>(this->stride), this->sentinel);
+			return this->row_begin(this->size_y++);
+		}
+
+		// width of row y before any sentinel ('\0' until add_border()) padding
+		dimension_t row_width(const dimension_t y) const {
+			const char *row = this->row_begin(y);
+			// the row's own cells, not the halo or the next row's
+			dimension_t width = this->stride - 2 * this->border;
+			while (width > 0 && row[width - 1] == this->sentinel) {
+				width--;
+			}
+			return width;
+		}
+
+		// re-lay the buffer out with a wider stride, halo included
+		void restride(const dimension_t width) {
+			const dimension_t new_stride = align_stride(width + 2 * this->border);
+			const dimension_t rows = this->size_y + 2 * this->border;
+			std::vector<char> wider(static_cast<size_t>(new_stride * rows), this->sentinel);
+			for (dimension_t y = 0; y < rows; y++) {
+				std::copy_n(this->data.data() + y * this->stride, this->stride, 
+							wider.data() + y * new_stride);
+			}
+
+			this->data = std::move(wider);
+			this->stride = new_stride;
+		}
+
+		void add_row(const char *chars, const size_t length) {
+			const dimension_t width = static_cast<dimension_t>(length);
+			if (this->size_y == 0) {
+				this->size_x = width;
+			}
+
+			if (width + 2 * this->border > this->stride) {
+				this->restride(width);
+			}
+
+			std::copy_n(chars, length, this->append_row());
+		}
+};
+
+
+std::ostream& operator<<(std::ostream& os, const charmap_t &map);
+
+/* std::format not quite working right on clang 16 on macOS */
+template <>
+struct std::formatter<charmap_t> {
+    constexpr auto parse(std::format_parse_context& ctx) {
+        return ctx.begin();
+    }
+
+    auto format(const charmap_t& map, std::format_context& ctx) const {
+        auto out = ctx.out();
+		for (dimension_t y = 0; y < map.size_y; y++) {
+			for (const auto ch : map.row(y)) {
+				std::format_to(out, "{}", ch);
+			}
+			std::format_to(out, "\n");
+			// cannot format ranges yet either.
+			// std::format_to(out, "{:}\n", row);
+		}
+
+		return out;
+    }
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,176 @@
+#if !defined(FLAT_POINT_H)
+#define FLAT_POINT_H
+
+#include <vector>		// std::vector
+#include <utility>		// std::pair
+#include <algorithm>	// std::fill
+#include <cstdint>		// uint32_t
+
+#include "point.h"
+
+/* Open addressing hash set and map keyed on point_key_t.
+ *
+ * Entries are kept in one vector in insertion order, which is also the
+ * iteration order. The table is a power of two of {key, index} slots with
+ * linear probing, kept at most half full. Nothing is allocated per insert
+ * and clear() keeps both vectors so a set rebuilt every round (day20) reuses
+ * the same memory. There is no erase. Inserting a new key invalidates
+ * references, pointers and iterators to the entries, see operator[].
+ * Keys only hold points in point_key_t's 21 bit range.
+ */
+
+inline const point_key_t &flat_key_of(const point_key_t &key) {
+	return key;
+}
+
+template <typename Value>
+const point_key_t &flat_key_of(const std::pair<point_key_t, Value> &entry) {
+	return entry.first;
+}
+
+template <typename Entry>
+struct flat_point_table_t {
+	struct slot_t {
+		point_key_t key;
+		uint32_t index = 0;		// 1 + index into entries, 0 is an empty slot
+	};
+
+	std::vector<Entry> entries{};
+	std::vector<slot_t> slots{};
+
+	using iterator = typename std::vector<Entry>::iterator;
+	using const_iterator = typename std::vector<Entry>::const_iterator;
+
+	size_t size() const {
+		return entries.size();
+	}
+
+	bool empty() const {
+		return entries.empty();
+	}
+
+	iterator begin() {
+		return entries.begin();
+	}
+
+	iterator end() {
+		return entries.end();
+	}
+
+	const_iterator begin() const {
+		return entries.begin();
+	}
+
+	const_iterator end() const {
+		return entries.end();
+	}
+
+	// make room for n entries without rehashing
+	void reserve(size_t n) {
+		entries.reserve(n);
+		if (n * 2 > slots.size()) {
+			rehash(n * 2);
+		}
+	}
+
+	// forget the entries, keep the memory
+	void clear() {
+		entries.clear();
+		std::fill(slots.begin(), slots.end(), slot_t{});
+	}
+
+	iterator find(const point_key_t &key) {
+		if (slots.empty()) {
+			return entries.end();
+		}
+
+		const uint32_t index = slots[probe(key)].index;
+		return index ? entries.begin() + (index - 1) : entries.end();
+	}
+
+	const_iterator find(const point_key_t &key) const {
+		if (slots.empty()) {
+			return entries.end();
+		}
+
+		const uint32_t index = slots[probe(key)].index;
+		return index ? entries.begin() + (index - 1) : entries.end();
+	}
+
+	bool contains(const point_key_t &key) const {
+		return !slots.empty() && slots[probe(key)].index != 0;
+	}
+
+protected:
+	static constexpr size_t min_slots = 16;
+
+	// slot holding key, or the empty slot where it would go
+	size_t probe(const point_key_t &key) const {
+		const size_t mask = slots.size() - 1;
+		size_t i = mix_key(key.key) & mask;
+		while (slots[i].index && !(slots[i].key == key)) {
+			i = (i + 1) & mask;
+		}
+
+		return i;
+	}
+
+	/* add entry if its key is not there yet, returns the entry for the key.
+	 * The pointer is into entries, good until the next insert of a new
+	 * key (which can grow the vector and move them all). */
+	std::pair<Entry *, bool> insert_entry(const Entry &entry) {
+		const point_key_t &key = flat_key_of(entry);
+		size_t i = slots.empty() ? 0 : probe(key);
+		if (!slots.empty() && slots[i].index) {
+			return {&entries[slots[i].index - 1], false};
+		}
+
+		// only a new entry can make the table too full
+		if ((entries.size() + 1) * 2 > slots.size()) {
+			rehash(slots.size() * 2);
+			i = probe(key);
+		}
+
+		entries.push_back(entry);
+		slots[i] = {key, static_cast<uint32_t>(entries.size())};
+		return {&entries.back(), true};
+	}
+
+	void rehash(size_t wanted) {
+		size_t n = min_slots;
+		while (n < wanted) {
+			n *= 2;
+		}
+
+		slots.assign(n, slot_t{});
+		for (size_t i = 0; i < entries.size(); i++) {
+			const point_key_t &key = flat_key_of(entries[i]);
+			slots[probe(key)] = {key, static_cast<uint32_t>(i + 1)};
+		}
+	}
+};
+
+struct flat_point_set_t : flat_point_table_t<point_key_t> {
+	// true if the point was not already in the set
+	bool insert(const point_key_t &key) {
+		return insert_entry(key).second;
+	}
+
+	bool emplace(const point_key_t &key) {
+		return insert(key);
+	}
+};
+
+template <typename Value>
+struct flat_point_map_t : flat_point_table_t<std::pair<point_key_t, Value>> {
+	/* value for key, inserting a default one if it is not there. Like a
+	 * vector element, and unlike std::unordered_map, the reference is only
+	 * good until a new key goes in. `m[a] = m[b]` reads m[b] through a
+	 * dangling reference when a is new, copy the value out first. Iterators
+	 * go the same way. */
+	Value &operator[](const point_key_t &key) {
+		return this->insert_entry({key, Value{}}).first->second;
+	}
+};
+
+#endif
@@ -0,0 +1,153 @@
+#if !defined(INPUT_VIEW_H)
+#define INPUT_VIEW_H
+
+#include <string>		// std::string
+#include <string_view>	// std::string_view
+#include <iterator>		// std::default_sentinel_t
+#include <ranges>		// std::ranges::view_interface
+#include <charconv>		// std::from_chars
+
+#include <fcntl.h>		// open
+#include <unistd.h>		// close
+#include <sys/mman.h>	// mmap, munmap
+#include <sys/stat.h>	// fstat
+
+/* Split text on any of the delims without copying, each piece is a
+ * string_view into the original text. Lazy, the next piece is found as the
+ * iterator moves. With keep_empty two delims in a row give an empty piece
+ * (a blank line between sections), otherwise runs of delims are skipped.
+ */
+struct split_view_t : std::ranges::view_interface<split_view_t> {
+	std::string_view text{};
+	std::string_view delims{};
+	bool keep_empty = false;
+
+	split_view_t() {}
+
+	split_view_t(std::string_view text, std::string_view delims, bool keep_empty) :
+		text(text), delims(delims), keep_empty(keep_empty) {
+	}
+
+	class iterator {
+		std::string_view rest{};
+		std::string_view delims{};
+		std::string_view piece{};
+		bool keep_empty = false;
+		bool done = true;
+
+	public:
+		using value_type = std::string_view;
+		using difference_type = std::ptrdiff_t;
+
+		iterator() {}
+
+		iterator(std::string_view text, std::string_view delims, bool keep_empty) :
+			rest(text), delims(delims), piece(), keep_empty(keep_empty), done(false) {
+			next();
+		}
+
+		std::string_view operator*() const {
+			return piece;
+		}
+
+		iterator &operator++() {
+			next();
+			return *this;
+		}
+
+		iterator operator++(int) {
+			iterator was = *this;
+			next();
+			return was;
+		}
+
+		bool operator==([[maybe_unused]] std::default_sentinel_t end) const {
+			return done;
+		}
+
+	private:
+		void next() {
+			do {
+				// a trailing delim does not start another (empty) piece
+				if (rest.empty()) {
+					done = true;
+					return;
+				}
+
+				const size_t end = rest.find_first_of(delims);
+				piece = rest.substr(0, end);
+				rest = (end == std::string_view::npos) ? std::string_view{} : rest.substr(end + 1);
+			} while (!keep_empty && piece.empty());
+		}
+	};
+
+	iterator begin() const {
+		return {text, delims, keep_empty};
+	}
+
+	std::default_sentinel_t end() const {
+		return {};
+	}
+};
+
+// whitespace (or delims) separated fields of a line, empty fields skipped
+inline split_view_t fields(std::string_view line, std::string_view delims = " \t") {
+	return {line, delims, false};
+}
+
+// number at the start of a field, 0 if there is not one
+template <typename T>
+T to_number(std::string_view field) {
+	T value = 0;
+	std::from_chars(field.data(), field.data() + field.size(), value);
+	return value;
+}
+
+/* Whole input file mapped read only. Nothing is copied, lines() and
+ * text() are views straight into the mapping so they are only good while
+ * this is alive. A file that is missing or empty reads as no lines, the
+ * same as an ifstream that failed to open.
+ */
+struct input_view_t {
+	const char *bytes = nullptr;
+	size_t length = 0;
+
+	explicit input_view_t(const std::string &filename) : bytes(nullptr), length(0) {
+		const int fd = open(filename.c_str(), O_RDONLY);
+		if (fd < 0) {
+			return;
+		}
+
+		struct stat info;
+		if (fstat(fd, &info) == 0 && info.st_size > 0) {
+			void *map = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+			if (map != MAP_FAILED) {
+				madvise(map, static_cast<size_t>(info.st_size), MADV_SEQUENTIAL);
+				bytes = static_cast<const char *>(map);
+				length = static_cast<size_t>(info.st_size);
+			}
+		}
+
+		close(fd);
+	}
+
+	input_view_t(const input_view_t &) = delete;
+	input_view_t &operator=(const input_view_t &) = delete;
+
+	~input_view_t() {
+		if (bytes) {
+			munmap(const_cast<char *>(bytes), length);
+		}
+	}
+
+	std::string_view text() const {
+		return {bytes, length};
+	}
+
+	// every line without its '\n', blank lines included
+	split_view_t lines() const {
+		return {text(), "\n", true};
+	}
+};
+
+#endif
@@ -3,10 +3,11 @@
 #include <sstream>		// std::ostringstream
 #include <string>		// std::string
 
-#include "vector.h"
+#include "point.h"
 
-std::ostream& operator<<(std::ostream& os, const vector_t &p) {
-	std::ostringstream buffer;
-	os << p.p << "," << p.dir;
+std::ostream& operator<<(std::ostream& os, const std::vector<point_t> &v) {
+	for (auto &p : v) {
+		os << p << " ";
+	}
 	return os;
 }
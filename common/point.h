@@ -0,0 +1,354 @@
+#if !defined(POINT_T_H)
+#define POINT_T_H
+
+#include <iostream>		// cout
+#include <iomanip>		// setw and setprecision on output
+#include <string>		// std::string
+#include <string_view>	// std::string_view
+#include <vector>
+#include <tuple>
+#include <cstdint>		// uint64_t
+#include <concepts>
+#include <cassert>		// assert macro
+#include <format>		// std::formatter
+
+#include "scan.h"
+#include "input_view.h"
+
+using dimension_t = long;
+using value_t = long;
+
+/* Coordinates only, split out so a 2D point has no z at all. */
+template <typename T, size_t Dims>
+struct point_coords_t;
+
+template <typename T>
+struct point_coords_t<T, 2> {
+	T x = 0;
+	T y = 0;
+};
+
+template <typename T>
+struct point_coords_t<T, 3> {
+	T x = 0;
+	T y = 0;
+	T z = 0;
+};
+
+/* A point with Dims coordinates of type T and nothing else. The special
+ * members are defaulted so it is trivially copyable; a vector of them is
+ * just the coordinates back to back and copies are a memcpy.
+ */
+template <typename T, size_t Dims>
+struct basic_point : point_coords_t<T, Dims> {
+	static_assert(Dims == 2 || Dims == 3, "basic_point is 2D or 3D");
+
+	using coord_t = T;
+	static constexpr size_t dims = Dims;
+
+	basic_point() = default;
+	basic_point(const basic_point &) = default;
+	basic_point &operator=(const basic_point &) = default;
+
+	/* Use templates for constructor so I don't have to worry about
+	* mixing int and unsigned int, size_t, etc. on creation. */
+	template <std::convertible_to<T> Tx, std::convertible_to<T> Ty>
+	basic_point(Tx x, Ty y) {
+		this->x = static_cast<T>(x);
+		this->y = static_cast<T>(y);
+	}
+
+	template <std::convertible_to<T> Tx, std::convertible_to<T> Ty, std::convertible_to<T> Tz>
+	requires (Dims > 2)
+	basic_point(Tx x, Ty y, Tz z) {
+		this->x = static_cast<T>(x);
+		this->y = static_cast<T>(y);
+		this->z = static_cast<T>(z);
+	}
+
+	template <std::convertible_to<T> Tx, std::convertible_to<T> Ty>
+	basic_point(const std::pair<Tx, Ty> &p) {
+		this->x = static_cast<T>(p.first);
+		this->y = static_cast<T>(p.second);
+	}
+
+	template <std::convertible_to<T> V>
+	basic_point(const std::vector<V> &v) {
+		if (v.size() > 0) {
+			this->x = static_cast<T>(v[0]);
+			if (v.size() > 1) {
+				this->y = static_cast<T>(v[1]);
+				if constexpr (Dims > 2) {
+					if (v.size() > 2) {
+						this->z = static_cast<T>(v[2]);
+					}
+				}
+			}
+		}
+	}
+
+	// z of a 2D point is 0
+	T z_or_zero() const {
+		if constexpr (Dims > 2) {
+			return this->z;
+		} else {
+			return 0;
+		}
+	}
+
+	bool operator<(const basic_point &rhs) const {		
+		// sorts by x, then y, then z
+		if (this->x == rhs.x) {
+			if (this->y == rhs.y) {
+				return this->z_or_zero() < rhs.z_or_zero();
+			}
+
+			return this->y < rhs.y;
+		}
+
+		return this->x < rhs.x;		
+	}
+
+	bool operator==(const basic_point &other) const {
+		return this->x == other.x
+			&& this->y == other.y
+			&& this->z_or_zero() == other.z_or_zero();
+	}
+
+	bool operator!=(const basic_point &other) const {
+		return !(*this == other);
+	}
+
+	basic_point &operator+=(const basic_point& rhs) {
+		this->x += rhs.x;
+		this->y += rhs.y;
+		if constexpr (Dims > 2) {
+			this->z += rhs.z;
+		}
+		return *this;
+	}
+
+	// friends defined inside class body are inline and are hidden from non-ADL lookup
+	friend basic_point operator+(basic_point lhs, const basic_point &rhs) {
+		lhs += rhs; // reuse compound assignment
+		return lhs; // return the result by value (uses move constructor)
+	}
+
+	basic_point &operator-=(const basic_point& rhs) {
+		this->x -= rhs.x;
+		this->y -= rhs.y;
+		if constexpr (Dims > 2) {
+			this->z -= rhs.z;
+		}
+		return *this;
+	}
+
+	// friends defined inside class body are inline and are hidden from non-ADL lookup
+	friend basic_point operator-(basic_point lhs, const basic_point &rhs) {
+		lhs -= rhs; // reuse compound assignment
+		return lhs; // return the result by value (uses move constructor)
+	}
+
+	// all the numbers in str, "-1,2,3" or "fold along y=7"
+	static basic_point from_string(std::string_view str) {
+		return {scan_numbers<long>(str)};
+	}
+};
+
+/* A point with a value riding along, e.g. the character at that spot in a
+ * charmap. Kept out of basic_point so plain points do not pay for it.
+ */
+template <typename Point, typename Value>
+struct valued_point_t : Point {
+	Value w{};
+};
+
+// compact points for when the coordinates are known to be small
+using point2_t = basic_point<int32_t, 2>;
+using point3_t = basic_point<int32_t, 3>;
+
+using point_t = basic_point<dimension_t, 3>;
+
+template <typename T, size_t Dims>
+std::ostream& operator<<(std::ostream& os, const basic_point<T, Dims> &p) {
+	os << "(" << p.x << "," << p.y;
+	if (p.z_or_zero()) {
+		os << "," << p.z_or_zero();
+	}
+	os << ")";
+	return os;
+}
+
+template <typename T, size_t Dims>
+std::istream& operator>>(std::istream& is, basic_point<T, Dims> &p) {
+	char delim;
+	if (is >> p.x >> delim >> p.y) {
+		if constexpr (Dims > 2) {
+			if (is.get() == delim) {
+				is >> p.z;
+			}
+		}
+	}
+
+    return is;
+}
+
+std::ostream& operator<<(std::ostream& os, const std::vector<point_t> &v);
+
+/* A point_t packed into one 64 bit word, {x, y, z} get 21 bits each.
+ * Axes are offset by 2^20 so anything in -1048576 .. 1048575 fits and two
+ * different points in that range never share a key, a 2D point has z = 0.
+ * A coordinate outside it would alias a point inside, pack() asserts.
+ * Converts to and from point_t so it can be the key type of a set or map
+ * and still be used like a point.
+ */
+struct point_key_t {
+	static constexpr int axis_bits = 21;
+	static constexpr int64_t axis_offset = int64_t{1} << (axis_bits - 1);
+	static constexpr uint64_t axis_mask = (uint64_t{1} << axis_bits) - 1;
+
+	uint64_t key = 0;
+
+	point_key_t() {}
+
+	template <typename T, size_t Dims>
+	point_key_t(const basic_point<T, Dims> &p) :
+		key((pack(p.x) << (2 * axis_bits)) | (pack(p.y) << axis_bits) | pack(p.z_or_zero())) {
+	}
+
+	operator point_t() const {
+		return to_point<point_t>();
+	}
+
+	template <typename Point>
+	Point to_point() const {
+		using T = typename Point::coord_t;
+		Point p{static_cast<T>(unpack(key >> (2 * axis_bits))),
+				static_cast<T>(unpack(key >> axis_bits))};
+		if constexpr (Point::dims > 2) {
+			p.z = static_cast<T>(unpack(key));
+		}
+		return p;
+	}
+
+	bool operator==(const point_key_t &other) const {
+		return key == other.key;
+	}
+
+	bool operator<(const point_key_t &other) const {
+		return key < other.key;
+	}
+
+	static uint64_t pack(int64_t v) {
+		assert(v >= -axis_offset && v < axis_offset);
+		return static_cast<uint64_t>(v + axis_offset) & axis_mask;
+	}
+
+	static int64_t unpack(uint64_t bits) {
+		return static_cast<int64_t>(bits & axis_mask) - axis_offset;
+	}
+};
+
+/* splitmix64 finalizer, every bit of the key moves every bit of the hash
+ * so nearby points land in different buckets. A bijection, no collisions.
+ */
+inline size_t mix_key(uint64_t k) {
+	k = (k ^ (k >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	k = (k ^ (k >> 27)) * 0x94d049bb133111ebULL;
+	return static_cast<size_t>(k ^ (k >> 31));
+}
+
+template <>
+struct std::hash<point_key_t> {
+	size_t operator()(const point_key_t &k) const {
+		return mix_key(k.key);
+	}
+};
+
+/* hash function so can be put in unordered_map or set. Through point_key_t,
+ * so only for points with every coordinate in -1048576 .. 1048575; pack()
+ * asserts on anything else. */
+template <typename T, size_t Dims>
+struct std::hash<basic_point<T, Dims>> {
+	size_t operator()(const basic_point<T, Dims> &p) const {
+		return mix_key(point_key_t(p).key);
+	}
+};
+
+template <typename T, size_t Dims>
+struct std::formatter<basic_point<T, Dims>> {
+    constexpr auto parse(std::format_parse_context &context) {
+        return context.begin();
+    }
+
+    auto format(const basic_point<T, Dims> &p, std::format_context &context) const {
+        auto out = context.out();
+
+		std::format_to(out, "({},{}", p.x, p.y);
+		if (p.z_or_zero()) {
+			std::format_to(out, ",{}", p.z_or_zero());
+		}
+		std::format_to(out, ")");
+
+		return out;
+    }
+};
+
+template <typename T, size_t Dims>
+T manhattan_distance(const basic_point<T, Dims> &p1, const basic_point<T, Dims> &p2) {
+	T dx = p1.x > p2.x ? p1.x - p2.x : p2.x - p1.x;
+	T dy = p1.y > p2.y ? p1.y - p2.y : p2.y - p1.y;
+	T dz = p1.z_or_zero() > p2.z_or_zero() ? p1.z_or_zero() - p2.z_or_zero() : p2.z_or_zero() - p1.z_or_zero();
+	return dx + dy + dz;
+}
+
+/* Read points, one per line from istream until end of file or empty line.
+ * optionally, call callback function to modify point before being emplaced.
+ * gets copy of the line/string used to create the point for use.
+ */
+template <typename Point = point_t>
+std::vector<Point> read_points(std::istream& is, void (*fn)(Point &point, const std::string &line) = nullptr) {
+	std::vector<Point> points;
+
+	std::string line;
+	while (std::getline(is, line)) {
+		if (line.empty()) {
+			return points;
+		}
+
+		Point pt{Point::from_string(line)};
+		if (fn != nullptr) {
+			fn(pt, line);
+		}
+
+		points.emplace_back(pt);
+	}
+
+	return points;
+}
+
+/* The same for input_view_t lines, starting at line and leaving it past
+ * the empty line that ends the points, or at the end of the input.
+ */
+template <typename Point = point_t>
+std::vector<Point> read_points(split_view_t::iterator &line, void (*fn)(Point &point, std::string_view line) = nullptr) {
+	std::vector<Point> points;
+
+	for (; line != std::default_sentinel; ++line) {
+		if ((*line).empty()) {
+			++line;
+			return points;
+		}
+
+		Point pt{Point::from_string(*line)};
+		if (fn != nullptr) {
+			fn(pt, *line);
+		}
+
+		points.emplace_back(pt);
+	}
+
+	return points;
+}
+
+#endif
@@ -0,0 +1,168 @@
+#if !defined(POINT_CLOUD_H)
+#define POINT_CLOUD_H
+
+#include <vector>		// std::vector
+#include <utility>		// std::pair
+#include <tuple>		// std::tie
+#include <algorithm>	// std::min, std::max
+#include <new>			// std::align_val_t
+
+#include "point.h"
+
+/* Structure of arrays for a lot of points; all the x, then all the y, then
+ * all the z, each array 32 byte aligned. The bulk operations are straight
+ * loops over whole arrays with no branches so the compiler vectorizes them
+ * (SSE2 out of the box, AVX2 with -march=native).
+ *
+ * Use a vector<point_t> to work with one point at a time, this to do the
+ * same thing to every point.
+ */
+
+template <typename T, size_t Align = 32>
+struct aligned_allocator_t {
+	using value_type = T;
+
+	// allocator_traits can not rebind through the size_t parameter
+	template <typename U>
+	struct rebind {
+		using other = aligned_allocator_t<U, Align>;
+	};
+
+	aligned_allocator_t() = default;
+
+	template <typename U>
+	aligned_allocator_t([[maybe_unused]] const aligned_allocator_t<U, Align> &other) {}
+
+	T *allocate(size_t n) {
+		return static_cast<T *>(::operator new(n * sizeof(T), std::align_val_t(Align)));
+	}
+
+	void deallocate(T *p, [[maybe_unused]] size_t n) {
+		::operator delete(p, std::align_val_t(Align));
+	}
+
+	bool operator==([[maybe_unused]] const aligned_allocator_t &other) const {
+		return true;
+	}
+};
+
+template <typename Point>
+struct point_cloud_t {
+	using coord_t = decltype(Point::x);
+	using array_t = std::vector<coord_t, aligned_allocator_t<coord_t>>;
+
+	static constexpr bool has_z = requires(Point p) { p.z; };
+
+	array_t x{};
+	array_t y{};
+	array_t z{};	// stays empty for 2D points
+
+	point_cloud_t() {}
+
+	explicit point_cloud_t(const std::vector<Point> &points) : x(), y(), z() {
+		reserve(points.size());
+		for (const auto &p : points) {
+			push_back(p);
+		}
+	}
+
+	size_t size() const {
+		return x.size();
+	}
+
+	bool empty() const {
+		return x.empty();
+	}
+
+	void reserve(size_t n) {
+		x.reserve(n);
+		y.reserve(n);
+		if constexpr (has_z) {
+			z.reserve(n);
+		}
+	}
+
+	void clear() {
+		x.clear();
+		y.clear();
+		z.clear();
+	}
+
+	void push_back(const Point &p) {
+		x.push_back(p.x);
+		y.push_back(p.y);
+		if constexpr (has_z) {
+			z.push_back(p.z);
+		}
+	}
+
+	Point operator[](size_t i) const {
+		Point p;
+		p.x = x[i];
+		p.y = y[i];
+		if constexpr (has_z) {
+			p.z = z[i];
+		}
+		return p;
+	}
+
+	std::vector<Point> to_points() const {
+		std::vector<Point> points;
+		points.reserve(size());
+		for (size_t i = 0; i < size(); i++) {
+			points.emplace_back((*this)[i]);
+		}
+		return points;
+	}
+
+	/* Multiply every point by the integer matrix m, rows m[0], m[1], m[2]
+	 * each a point (e.g. one of the 24 axis rotations), then add offset.
+	 */
+	template <typename Matrix>
+	requires has_z
+	void transform(const Matrix &m, const Point &offset) {
+		// copy out so the loop does not reload them through m
+		const coord_t m00 = m[0].x, m01 = m[0].y, m02 = m[0].z;
+		const coord_t m10 = m[1].x, m11 = m[1].y, m12 = m[1].z;
+		const coord_t m20 = m[2].x, m21 = m[2].y, m22 = m[2].z;
+		const coord_t dx = offset.x, dy = offset.y, dz = offset.z;
+
+		coord_t *px = x.data();
+		coord_t *py = y.data();
+		coord_t *pz = z.data();
+		for (size_t i = 0; i < size(); i++) {
+			const coord_t x0 = px[i];
+			const coord_t y0 = py[i];
+			const coord_t z0 = pz[i];
+			px[i] = x0 * m00 + y0 * m01 + z0 * m02 + dx;
+			py[i] = x0 * m10 + y0 * m11 + z0 * m12 + dy;
+			pz[i] = x0 * m20 + y0 * m21 + z0 * m22 + dz;
+		}
+	}
+
+	// smallest and largest point on each axis, cloud must not be empty
+	std::pair<Point, Point> bounds() const {
+		Point low;
+		Point high;
+		std::tie(low.x, high.x) = min_max(x);
+		std::tie(low.y, high.y) = min_max(y);
+		if constexpr (has_z) {
+			std::tie(low.z, high.z) = min_max(z);
+		}
+		return {low, high};
+	}
+
+private:
+	static std::pair<coord_t, coord_t> min_max(const array_t &a) {
+		const coord_t *p = a.data();
+		coord_t low = p[0];
+		coord_t high = p[0];
+		for (size_t i = 1; i < a.size(); i++) {
+			low = std::min(low, p[i]);
+			high = std::max(high, p[i]);
+		}
+		return {low, high};
+	}
+};
+
+#endif
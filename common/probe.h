@@ -0,0 +1,159 @@
+#if !defined(PROBE_H)
+#define PROBE_H
+
+#include <chrono>		// high resolution timer
+#include <iostream>		// cerr
+#include <iomanip>		// setw and setprecision on output
+#include <deque>		// std::deque
+#include <atomic>		// std::atomic
+#include <cstdint>		// uint64_t
+
+/* Counters and timers for inside the hot loops, compiled in only with
+ * AOC_PROBES defined (cmake -DAOC_PROBES=ON, or -DAOC_PROBES on the
+ * compiler line). Without it every type here is empty and every call a
+ * no-op, so they can stay in the code.
+ *
+ * Declare them once, at file scope:
+ *
+ *	static probe_counter_t states_expanded("day23 states expanded");
+ *	static probe_timer_t search_time("day23 dijkstra");
+ *
+ * then in the code
+ *
+ *	++states_expanded;
+ *	probe_scope_t scope(search_time);	// times to the end of the block
+ *
+ * Everything declared is printed on cerr when the program exits:
+ *
+ *	probe                                  count        total ms      mean us
+ *	day23 dijkstra                             2       1544.8745     772437.2
+ *	day23 states expanded                 230465
+ */
+
+#if defined(AOC_PROBES)
+
+struct probe_registry_t {
+	struct entry_t {
+		const char *name = "";
+		bool timed = false;
+		std::atomic<uint64_t> count{0};
+		std::atomic<uint64_t> nanoseconds{0};
+	};
+
+	std::deque<entry_t> entries{};	// deque, entries never move
+
+	// the one registry, made by the first probe so it outlives them all
+	static probe_registry_t &get() {
+		static probe_registry_t registry;
+		return registry;
+	}
+
+	entry_t *add(const char *name, bool timed) {
+		entry_t &entry = entries.emplace_back();
+		entry.name = name;
+		entry.timed = timed;
+		return &entry;
+	}
+
+	~probe_registry_t() {
+		const int name_width = 32;
+		const int count_width = 12;
+		const int time_width = 16;
+
+		std::cerr << std::left << std::setw(name_width) << "probe" << std::right
+			<< std::setw(count_width) << "count"
+			<< std::setw(time_width) << "total ms"
+			<< std::setw(count_width + 1) << "mean us" << std::endl;
+
+		for (const auto &entry : entries) {
+			const uint64_t count = entry.count.load();
+			std::cerr << std::left << std::setw(name_width) << entry.name << std::right
+				<< std::setw(count_width) << count;
+			if (entry.timed) {
+				const double ms = static_cast<double>(entry.nanoseconds.load()) / 1e6;
+				std::cerr << std::fixed
+					<< std::setw(time_width) << std::setprecision(4) << ms
+					<< std::setw(count_width + 1) << std::setprecision(1)
+					<< (count ? ms * 1000.0 / static_cast<double>(count) : 0.0);
+			}
+			std::cerr << std::endl;
+		}
+	}
+};
+
+struct probe_counter_t {
+	probe_registry_t::entry_t *entry;
+
+	explicit probe_counter_t(const char *name) :
+		entry(probe_registry_t::get().add(name, false)) {
+	}
+
+	probe_counter_t(const probe_counter_t &) = delete;
+	probe_counter_t &operator=(const probe_counter_t &) = delete;
+
+	probe_counter_t &operator++() {
+		entry->count.fetch_add(1, std::memory_order_relaxed);
+		return *this;
+	}
+
+	void add(uint64_t n) {
+		entry->count.fetch_add(n, std::memory_order_relaxed);
+	}
+};
+
+// total time and how many times, see probe_scope_t
+struct probe_timer_t {
+	probe_registry_t::entry_t *entry;
+
+	explicit probe_timer_t(const char *name) :
+		entry(probe_registry_t::get().add(name, true)) {
+	}
+
+	probe_timer_t(const probe_timer_t &) = delete;
+	probe_timer_t &operator=(const probe_timer_t &) = delete;
+
+	void add(std::chrono::nanoseconds duration) {
+		entry->count.fetch_add(1, std::memory_order_relaxed);
+		entry->nanoseconds.fetch_add(static_cast<uint64_t>(duration.count()), std::memory_order_relaxed);
+	}
+};
+
+struct probe_scope_t {
+	using clock = std::chrono::high_resolution_clock;
+
+	probe_timer_t &timer;
+	clock::time_point start;
+
+	explicit probe_scope_t(probe_timer_t &timer) : timer(timer), start(clock::now()) {
+	}
+
+	probe_scope_t(const probe_scope_t &) = delete;
+	probe_scope_t &operator=(const probe_scope_t &) = delete;
+
+	~probe_scope_t() {
+		timer.add(std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start));
+	}
+};
+
+#else
+
+struct probe_counter_t {
+	constexpr explicit probe_counter_t([[maybe_unused]] const char *name) {}
+	probe_counter_t &operator++() {
+		return *this;
+	}
+	void add([[maybe_unused]] uint64_t n) {}
+};
+
+struct probe_timer_t {
+	constexpr explicit probe_timer_t([[maybe_unused]] const char *name) {}
+	void add([[maybe_unused]] std::chrono::nanoseconds duration) {}
+};
+
+struct probe_scope_t {
+	constexpr explicit probe_scope_t([[maybe_unused]] probe_timer_t &timer) {}
+};
+
+#endif
+
+#endif
@@ -0,0 +1,82 @@
+#include <atomic>		// std::atomic
+#include <new>			// operator new, std::bad_alloc
+#include <cstdlib>		// malloc, free, aligned_alloc
+#include <cstdint>		// uint64_t
+
+#if defined(AOC_TRACK_ALLOC)
+#if defined(__APPLE__)
+#include <malloc/malloc.h>	// malloc_size
+#else
+#include <malloc.h>			// malloc_usable_size
+#endif
+#endif
+
+#include "report.h"
+
+/* The replacement operator new and delete behind report.h's allocation
+ * counts, linked into each day executable and nothing else.
+ */
+
+// size malloc really gave p, which is also what free gives back
+static uint64_t block_size([[maybe_unused]] void *p) {
+#if defined(AOC_TRACK_ALLOC) && defined(__APPLE__)
+	return malloc_size(p);
+#elif defined(AOC_TRACK_ALLOC)
+	return malloc_usable_size(p);
+#else
+	return 0;
+#endif
+}
+
+static void *note_alloc(void *p) {
+	if (!p) {
+		throw std::bad_alloc();
+	}
+
+	allocation_count.fetch_add(1, std::memory_order_relaxed);
+	if constexpr (track_alloc) {
+		const uint64_t size = block_size(p);
+		allocation_bytes.fetch_add(size, std::memory_order_relaxed);
+		const uint64_t live = live_bytes.fetch_add(size, std::memory_order_relaxed) + size;
+		uint64_t peak = peak_live_bytes.load(std::memory_order_relaxed);
+		while (live > peak && !peak_live_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+		}
+	}
+	return p;
+}
+
+static void note_free(void *p) {
+	if constexpr (track_alloc) {
+		if (p) {
+			live_bytes.fetch_sub(block_size(p), std::memory_order_relaxed);
+		}
+	}
+	free(p);
+}
+
+// all kept out of line, gcc sees malloc() paired with delete (or new with
+// free()) once they are inlined (LTO) and warns -Wmismatched-new-delete
+[[gnu::noinline]] void *operator new(size_t size) {
+	return note_alloc(malloc(size ? size : 1));
+}
+
+[[gnu::noinline]] void *operator new(size_t size, std::align_val_t align) {
+	const size_t alignment = static_cast<size_t>(align);
+	return note_alloc(aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment));
+}
+
+[[gnu::noinline]] void operator delete(void *p) noexcept {
+	note_free(p);
+}
+
+[[gnu::noinline]] void operator delete(void *p, [[maybe_unused]] size_t size) noexcept {
+	note_free(p);
+}
+
+[[gnu::noinline]] void operator delete(void *p, [[maybe_unused]] std::align_val_t align) noexcept {
+	note_free(p);
+}
+
+[[gnu::noinline]] void operator delete(void *p, [[maybe_unused]] size_t size, [[maybe_unused]] std::align_val_t align) noexcept {
+	note_free(p);
+}
@@ -0,0 +1,302 @@
+#if !defined(REPORT_H)
+#define REPORT_H
+
+#include <chrono>		// high resolution timer
+#include <iostream>		// cout
+#include <iomanip>		// setw and setprecision on output
+#include <sstream>		// ostringstream
+#include <string>		// std::string
+#include <string_view>	// std::string_view
+#include <vector>		// std::vector
+#include <atomic>		// std::atomic
+#include <cstdint>		// uint64_t
+#include <type_traits>	// std::is_convertible_v
+
+#include <sys/resource.h>	// getrusage
+
+/* Timings and answers for a run, printed one of three ways (-o on the
+ * command line):
+ *
+ * text  the usual fixed width lines as each phase finishes
+ *
+ *           parse (    0.0268ms)
+ *            1446 (    0.0392ms)
+ *            1486 (    0.0038ms)
+ *           total (    0.0698ms)
+ *
+ * json  one object when the run is done, times in nanoseconds
+ *
+ *       {"input": "input.txt", "parse_ns": 26800, "parse_allocs": 2011,
+ *        "part1_ns": 39200, "part1_allocs": 0, "part1": "1446", ...,
+ *        "total_ns": 69800, "allocs": 2013, "peak_rss_kb": 3712}
+ *
+ * csv   a header line and the same fields as one row, answers quoted
+ *
+ * Allocation counts come from the operator new in report.cpp. It is only
+ * linked into the day executables (aoc_alloc_hook); a day built into
+ * libaoc keeps the host's allocator and its counts stay at 0.
+ *
+ * Built with AOC_TRACK_ALLOC (cmake -DAOC_TRACK_ALLOC=ON) the hook also
+ * keeps bytes allocated and bytes live, at the price of asking malloc for
+ * the block size on every new and delete. Each phase then also has the
+ * bytes it allocated and the peak live bytes while it ran, at the end of
+ * the text lines and as _bytes and _peak_bytes in json and csv:
+ *
+ *           parse (    0.0268ms)      2011 allocs     41.3KiB  peak    40.9KiB
+ */
+
+enum class report_format_t { text, json, csv };
+
+// -o argument, text for anything not known
+inline report_format_t report_format(std::string_view name) {
+	if (name == "json") {
+		return report_format_t::json;
+	} else if (name == "csv") {
+		return report_format_t::csv;
+	}
+	return report_format_t::text;
+}
+
+// operator new calls so far
+inline std::atomic<uint64_t> allocation_count{0};
+
+#if defined(AOC_TRACK_ALLOC)
+constexpr bool track_alloc = true;
+#else
+constexpr bool track_alloc = false;
+#endif
+
+// bytes from operator new so far, live now and the most live since reset
+inline std::atomic<uint64_t> allocation_bytes{0};
+inline std::atomic<uint64_t> live_bytes{0};
+inline std::atomic<uint64_t> peak_live_bytes{0};
+
+// peak resident set of this process so far
+inline long peak_rss_kb() {
+	struct rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+#if defined(__APPLE__)
+	return usage.ru_maxrss / 1024;		// bytes on macOS
+#else
+	return usage.ru_maxrss;
+#endif
+}
+
+template <typename T>
+void print_result(T result, std::chrono::duration<double, std::milli> duration, const std::string &extra = "",
+	std::ostream &out = std::cout) {
+	const int time_width = 10;
+	const int time_precision = 4;
+	const int result_width = 15;
+
+	out << std::setw(result_width) << std::right << result;
+
+	out << " ("
+		 << std::setw(time_width) << std::fixed << std::right
+		 << std::setprecision(time_precision)
+		 << duration.count() << "ms)";
+	out << extra << std::endl;
+}
+
+struct report_t {
+	using clock = std::chrono::high_resolution_clock;
+
+	// parse has no answer, a part always has one (maybe empty)
+	enum class kind_t { parse, part };
+
+	struct phase_t {
+		std::string name;
+		kind_t kind;
+		std::string answer;
+		clock::duration duration;
+		uint64_t allocs;
+		uint64_t bytes;			// AOC_TRACK_ALLOC only
+		uint64_t peak_bytes;
+	};
+
+	report_format_t format = report_format_t::text;
+	std::string input{};
+	std::ostream &out;
+	bool header = true;		// the csv header line, batch.h prints its own
+	std::vector<phase_t> phases{};
+	clock::time_point start{};
+	clock::time_point last{};
+	uint64_t last_allocs = 0;
+	uint64_t last_bytes = 0;
+
+	// starts the clock
+	report_t(report_format_t format, const std::string &input, std::ostream &out = std::cout) :
+		format(format), input(input), out(out), phases(),
+		start(clock::now()), last(start),
+		last_allocs(allocation_count.load()), last_bytes(allocation_bytes.load()) {
+		peak_live_bytes = live_bytes.load();
+	}
+
+	// end of parsing
+	void parsed() {
+		phase("parse", kind_t::parse, "");
+	}
+
+	// end of a part with its answer
+	template <typename T>
+	void part(const std::string &name, const T &result) {
+		if constexpr (std::is_convertible_v<T, std::string>) {
+			phase(name, kind_t::part, result);
+		} else {
+			phase(name, kind_t::part, std::to_string(result));
+		}
+	}
+
+	// the total, and in json or csv everything
+	void done() {
+		const auto total = last - start;
+		uint64_t allocs = 0;
+		for (const auto &p : phases) {
+			allocs += p.allocs;
+		}
+
+		switch (format) {
+			case report_format_t::text:
+				print_result("total", total, "", out);
+				break;
+
+			case report_format_t::json:
+				out << "{\"input\": " << quoted(input);
+				for (const auto &p : phases) {
+					out << ", \"" << p.name << "_ns\": " << nanoseconds(p.duration)
+						<< ", \"" << p.name << "_allocs\": " << p.allocs;
+					if (track_alloc) {
+						out << ", \"" << p.name << "_bytes\": " << p.bytes
+							<< ", \"" << p.name << "_peak_bytes\": " << p.peak_bytes;
+					}
+					if (p.kind == kind_t::part) {
+						out << ", \"" << p.name << "\": " << quoted(p.answer);
+					}
+				}
+				out << ", \"total_ns\": " << nanoseconds(total)
+					<< ", \"allocs\": " << allocs
+					<< ", \"peak_rss_kb\": " << peak_rss_kb() << "}" << std::endl;
+				break;
+
+			case report_format_t::csv:
+				if (header) {
+					csv_header(out);
+				}
+
+				out << csv_quoted(input);
+				for (const auto &p : phases) {
+					out << "," << nanoseconds(p.duration) << "," << p.allocs;
+					if (track_alloc) {
+						out << "," << p.bytes << "," << p.peak_bytes;
+					}
+					if (p.kind == kind_t::part) {
+						out << "," << csv_quoted(p.answer);
+					}
+				}
+				out << "," << nanoseconds(total) << "," << allocs << "," << peak_rss_kb() << std::endl;
+				break;
+		}
+	}
+
+	// the names of the columns done() writes
+	void csv_header(std::ostream &to) const {
+		to << "input";
+		for (const auto &p : phases) {
+			to << "," << p.name << "_ns," << p.name << "_allocs";
+			if (track_alloc) {
+				to << "," << p.name << "_bytes," << p.name << "_peak_bytes";
+			}
+			if (p.kind == kind_t::part) {
+				to << "," << p.name;
+			}
+		}
+		to << ",total_ns,allocs,peak_rss_kb" << std::endl;
+	}
+
+private:
+	void phase(const std::string &name, kind_t kind, const std::string &answer) {
+		const auto now = clock::now();
+		const uint64_t allocs = allocation_count.load();
+		const uint64_t bytes = allocation_bytes.load();
+		const phase_t &p = phases.emplace_back(phase_t{name, kind, answer, now - last,
+			allocs - last_allocs, bytes - last_bytes, peak_live_bytes.load()});
+
+		if (format == report_format_t::text) {
+			print_result(kind == kind_t::parse ? name : answer, now - last, track_alloc ? memory(p) : "", out);
+		}
+
+		// the next phase is timed from now, its allocations from after printing
+		last = now;
+		last_allocs = allocation_count.load();
+		last_bytes = allocation_bytes.load();
+		peak_live_bytes = live_bytes.load();
+	}
+
+	// "      2011 allocs     41.3KiB  peak    40.9KiB"
+	static std::string memory(const phase_t &p) {
+		std::ostringstream out;
+		out << std::setw(10) << p.allocs << " allocs" << std::setw(12) << bytes_text(p.bytes)
+			<< "  peak " << std::setw(10) << bytes_text(p.peak_bytes);
+		return out.str();
+	}
+
+	// 41.3KiB, 221.9MiB
+	static std::string bytes_text(uint64_t bytes) {
+		const char *units[] = {"B", "KiB", "MiB", "GiB"};
+		double value = static_cast<double>(bytes);
+		size_t unit = 0;
+		while (value >= 1024.0 && unit < 3) {
+			value /= 1024.0;
+			unit++;
+		}
+
+		std::ostringstream out;
+		out << std::fixed << std::setprecision(unit ? 1 : 0) << value << units[unit];
+		return out.str();
+	}
+
+	static long long nanoseconds(clock::duration d) {
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(d).count();
+	}
+
+	// a json string, control characters escaped
+	static std::string quoted(std::string_view s) {
+		std::string q = "\"";
+		for (const char c : s) {
+			if (c == '"' || c == '\\') {
+				q += '\\';
+				q += c;
+			} else if (c == '\n') {
+				q += "\\n";
+			} else if (c == '\r') {
+				q += "\\r";
+			} else if (c == '\t') {
+				q += "\\t";
+			} else if (static_cast<unsigned char>(c) < 0x20) {
+				static constexpr char hex[] = "0123456789abcdef";
+				q += "\\u00";
+				q += hex[(c >> 4) & 0xf];
+				q += hex[c & 0xf];
+			} else {
+				q += c;
+			}
+		}
+		q += '"';
+		return q;
+	}
+
+	// quotes doubled, newlines left in
+	static std::string csv_quoted(std::string_view s) {
+		std::string q = "\"";
+		for (const char c : s) {
+			if (c == '"') {
+				q += '"';
+			}
+			q += c;
+		}
+		q += '"';
+		return q;
+	}
+};
+
+#endif
@@ -0,0 +1,159 @@
+#if !defined(SCAN_H)
+#define SCAN_H
+
+#include <string_view>	// std::string_view
+#include <vector>		// std::vector
+#include <charconv>		// std::from_chars
+#include <cstring>		// memcpy
+#include <cstdint>		// uint64_t
+#include <bit>			// std::countr_zero, std::endian
+#include <type_traits>	// std::is_signed_v
+
+/* Integers straight out of a string_view, no copies and no allocation.
+ *
+ * next_number    every run of digits in the text is a number, whatever is
+ *                between them ("x=-5..3, y=2" is -5, 3, 2). A '-' right
+ *                before the digits makes it negative for signed types.
+ *                Runs are found eight bytes at a time.
+ * int_scanner_t  strtok style tokens between delims, a token that starts
+ *                with a number gives that number, anything else is skipped.
+ */
+
+// high bit set in each byte of w that is an ASCII digit
+inline uint64_t digit_bytes(const uint64_t w) {
+	const uint64_t ones = 0x0101010101010101ULL;
+	const uint64_t high = 0x8080808080808080ULL;
+
+	const uint64_t t = w ^ (ones * '0');				// digits are now 0..9
+	const uint64_t ten_up = ((t & ~high) | high) - ones * 10;	// high bit kept if >= 10
+	return ~(t | ten_up) & high;
+}
+
+// offset of the first flagged byte in a digit_bytes style mask
+inline size_t first_flagged_byte(const uint64_t mask) {
+	if constexpr (std::endian::native == std::endian::little) {
+		return static_cast<size_t>(std::countr_zero(mask)) / 8;
+	} else {
+		return static_cast<size_t>(std::countl_zero(mask)) / 8;
+	}
+}
+
+inline bool is_digit(const char c) {
+	return c >= '0' && c <= '9';
+}
+
+// position of the first digit at or after pos, text.size() if none
+inline size_t find_digit(const std::string_view text, size_t pos) {
+	while (pos + 8 <= text.size()) {
+		uint64_t w;
+		memcpy(&w, text.data() + pos, sizeof(w));
+		const uint64_t digits = digit_bytes(w);
+		if (digits) {
+			return pos + first_flagged_byte(digits);
+		}
+		pos += 8;
+	}
+
+	while (pos < text.size() && !is_digit(text[pos])) {
+		pos++;
+	}
+	return pos;
+}
+
+// position of the first non digit at or after pos, text.size() if none
+inline size_t find_non_digit(const std::string_view text, size_t pos) {
+	while (pos + 8 <= text.size()) {
+		uint64_t w;
+		memcpy(&w, text.data() + pos, sizeof(w));
+		const uint64_t others = ~digit_bytes(w) & 0x8080808080808080ULL;
+		if (others) {
+			return pos + first_flagged_byte(others);
+		}
+		pos += 8;
+	}
+
+	while (pos < text.size() && is_digit(text[pos])) {
+		pos++;
+	}
+	return pos;
+}
+
+/* Next number in text at or after pos into value and move pos past it.
+ * False when there are no more numbers.
+ */
+template <typename T>
+bool next_number(const std::string_view text, size_t &pos, T &value) {
+	size_t start = find_digit(text, pos);
+	if (start >= text.size()) {
+		pos = text.size();
+		return false;
+	}
+
+	const size_t end = find_non_digit(text, start);
+	if constexpr (std::is_signed_v<T>) {
+		if (start > 0 && text[start - 1] == '-') {
+			start--;
+		}
+	}
+
+	value = 0;
+	std::from_chars(text.data() + start, text.data() + end, value);
+	pos = end;
+	return true;
+}
+
+// all the numbers in text, see next_number
+template <typename T>
+std::vector<T> scan_numbers(const std::string_view text) {
+	std::vector<T> numbers;
+
+	size_t pos = 0;
+	T value;
+	while (next_number(text, pos, value)) {
+		numbers.push_back(value);
+	}
+
+	return numbers;
+}
+
+/* Tokens separated by any of delims, like strtok without the copy. A token
+ * starting with a digit (or '-' for signed types) is read like atoi; the
+ * number at its front, 0 for a lone '-'.
+ */
+template <typename T>
+struct int_scanner_t {
+	std::string_view text{};
+	std::string_view delims{};
+	size_t pos = 0;
+
+	int_scanner_t(const std::string_view text, const std::string_view delims) :
+		text(text), delims(delims), pos(0) {
+	}
+
+	bool next(T &value) {
+		while (true) {
+			pos = text.find_first_not_of(delims, pos);
+			if (pos == std::string_view::npos) {
+				pos = text.size();
+				return false;
+			}
+
+			size_t end = text.find_first_of(delims, pos);
+			if (end == std::string_view::npos) {
+				end = text.size();
+			}
+
+			const char first = text[pos];
+			const size_t start = pos;
+			pos = end;
+
+			if (is_digit(first) || (std::is_signed_v<T> && first == '-')) {
+				value = 0;
+				std::from_chars(text.data() + start, text.data() + end, value);
+				return true;
+			}
+		}
+	}
+};
+
+#endif
@@ -0,0 +1,242 @@
+#if !defined(SEARCH_H)
+#define SEARCH_H
+
+#include <vector>			// std::vector
+#include <queue>			// std::priority_queue, std::queue
+#include <unordered_map>	// std::unordered_map
+#include <functional>		// std::hash
+#include <limits>			// std::numeric_limits
+
+/* Generic graph search; Dijkstra, A*, BFS and path counting.
+ *
+ * Everything is a template parameter so the neighbor generator, cost and
+ * heuristic get inlined into the search loop.
+ *
+ * State     value type for a node, hashable for the default Dist
+ * Neighbors callable as neighbors(const State &u, emit), which calls
+ *           emit(const State &v, size_t cost) for each edge u -> v.
+ *           The cost functor lives here, the generator knows the move.
+ * Goal      callable as is_goal(const State &) -> bool
+ * Heuristic callable as heuristic(const State &) -> size_t, a lower bound
+ *           on the cost to a goal (never over-estimates)
+ * Dist      map of State -> best known cost; find(), end(), operator[]
+ * Pred      predecessor policy, no_pred_t or pred_list_t
+ */
+
+const size_t search_unreachable = std::numeric_limits<size_t>::max();
+
+// what a search did, to compare searches on the same problem
+struct search_stats_t {
+	size_t expanded = 0;	// states taken off the queue and expanded
+	size_t pushed = 0;		// entries put on the queue
+	size_t popped = 0;		// entries taken off, stale ones included
+	size_t stale = 0;		// popped after a cheaper way was found, skipped
+};
+
+// add what one search did to a running total
+inline void add_stats(search_stats_t &total, const search_stats_t &stats) {
+	total.expanded += stats.expanded;
+	total.pushed += stats.pushed;
+	total.popped += stats.popped;
+	total.stale += stats.stale;
+}
+
+// A* with this heuristic is Dijkstra
+struct zero_heuristic_t {
+	template <typename State>
+	size_t operator()([[maybe_unused]] const State &state) const {
+		return 0;
+	}
+};
+
+// do not track predecessors
+struct no_pred_t {
+	template <typename State>
+	void improve([[maybe_unused]] const State &v, [[maybe_unused]] const State &u) {}
+
+	template <typename State>
+	void tie([[maybe_unused]] const State &v, [[maybe_unused]] const State &u) {}
+};
+
+// track every equal cost predecessor, Map is State -> std::vector<State>
+template <typename Map>
+struct pred_list_t {
+	Map &pred;
+
+	explicit pred_list_t(Map &pred) : pred(pred) {}
+
+	template <typename State>
+	void improve(const State &v, const State &u) {
+		auto &from = pred[v];
+		from.clear();
+		from.emplace_back(u);
+	}
+
+	template <typename State>
+	void tie(const State &v, const State &u) {
+		pred[v].emplace_back(u);
+	}
+};
+
+/* A* search from start until is_goal. Returns the cost to the first goal
+ * reached or search_unreachable, dist is filled in as it goes.
+ * Entries in the queue that have been beaten since they were pushed are
+ * skipped when popped (lazy deletion, nothing is removed from the queue).
+ * A state is settled the first time it comes off the queue not stale, and
+ * with a consistent heuristic (or none) dist never improves after that,
+ * so dist doubles as the closed set; a settled state is never pushed or
+ * expanded again.
+ */
+template <typename State, typename Neighbors, typename Goal, typename Heuristic,
+			typename Dist, typename Pred = no_pred_t>
+size_t search_astar(const State &start, Neighbors &&neighbors, Goal &&is_goal,
+					Heuristic &&heuristic, Dist &dist, Pred &&pred = {},
+					search_stats_t *stats = nullptr) {
+	struct entry_t {
+		size_t estimate;	// cost + heuristic, queue order
+		size_t cost;
+		State state;
+
+		bool operator>(const entry_t &other) const {
+			return estimate > other.estimate;
+		}
+	};
+
+	std::priority_queue<entry_t, std::vector<entry_t>, std::greater<entry_t>> Q;
+
+	search_stats_t counts;
+
+	dist[start] = 0;
+	Q.push({heuristic(start), 0, start});
+	counts.pushed++;
+
+	while (!Q.empty()) {
+		entry_t u = Q.top();
+		Q.pop();
+		counts.popped++;
+
+		// stale, found a cheaper way here after this was pushed
+		if (u.cost > dist[u.state]) {
+			counts.stale++;
+			continue;
+		}
+
+		if (is_goal(u.state)) {
+			if (stats) {
+				add_stats(*stats, counts);
+			}
+			return u.cost;
+		}
+
+		counts.expanded++;
+
+		neighbors(u.state, [&](const State &v, const size_t step) {
+			const size_t cost = u.cost + step;
+
+			auto it = dist.find(v);
+			if (it == dist.end() || cost < it->second) {
+				dist[v] = cost;
+				pred.improve(v, u.state);
+				Q.push({cost + heuristic(v), cost, v});
+				counts.pushed++;
+			} else if (cost == it->second) {
+				pred.tie(v, u.state);
+			}
+		});
+	}
+
+	if (stats) {
+		add_stats(*stats, counts);
+	}
+	return search_unreachable;
+}
+
+template <typename State, typename Neighbors, typename Goal, typename Heuristic,
+			typename Dist = std::unordered_map<State, size_t>>
+size_t search_astar(const State &start, Neighbors &&neighbors, Goal &&is_goal,
+					Heuristic &&heuristic) {
+	Dist dist;
+	return search_astar(start, neighbors, is_goal, heuristic, dist);
+}
+
+/* Dijkstra; A* without a heuristic */
+template <typename State, typename Neighbors, typename Goal,
+			typename Dist, typename Pred = no_pred_t>
+size_t search_dijkstra(const State &start, Neighbors &&neighbors, Goal &&is_goal,
+					   Dist &dist, Pred &&pred = {}, search_stats_t *stats = nullptr) {
+	return search_astar(start, neighbors, is_goal, zero_heuristic_t{}, dist, pred, stats);
+}
+
+template <typename State, typename Neighbors, typename Goal,
+			typename Dist = std::unordered_map<State, size_t>>
+size_t search_dijkstra(const State &start, Neighbors &&neighbors, Goal &&is_goal) {
+	Dist dist;
+	return search_dijkstra(start, neighbors, is_goal, dist);
+}
+
+/* Breadth first search, every edge costs 1 (the emitted cost is ignored).
+ * Returns the number of edges to the nearest goal or search_unreachable.
+ */
+template <typename State, typename Neighbors, typename Goal,
+			typename Dist = std::unordered_map<State, size_t>>
+size_t search_bfs(const State &start, Neighbors &&neighbors, Goal &&is_goal, Dist &dist) {
+	std::queue<State> Q;
+
+	dist[start] = 0;
+	Q.push(start);
+
+	while (!Q.empty()) {
+		const State u = Q.front();
+		Q.pop();
+
+		const size_t cost = dist[u];
+		if (is_goal(u)) {
+			return cost;
+		}
+
+		neighbors(u, [&](const State &v, [[maybe_unused]] const size_t step) {
+			if (dist.find(v) == dist.end()) {
+				dist[v] = cost + 1;
+				Q.push(v);
+			}
+		});
+	}
+
+	return search_unreachable;
+}
+
+template <typename State, typename Neighbors, typename Goal,
+			typename Dist = std::unordered_map<State, size_t>>
+size_t search_bfs(const State &start, Neighbors &&neighbors, Goal &&is_goal) {
+	Dist dist;
+	return search_bfs(start, neighbors, is_goal, dist);
+}
+
+/* Count every walk from start to a goal. No de-duplication, so the
+ * neighbor generator has to make the state graph acyclic (e.g. carry a
+ * visited set in State). Walks stop at a goal. Iterative, the stack is
+ * one vector reused for the whole count.
+ */
+template <typename State, typename Neighbors, typename Goal>
+size_t count_paths(const State &start, Neighbors &&neighbors, Goal &&is_goal) {
+	size_t paths = 0;
+	std::vector<State> stack{start};
+
+	while (!stack.empty()) {
+		const State u = stack.back();
+		stack.pop_back();
+
+		if (is_goal(u)) {
+			paths++;
+			continue;
+		}
+
+		neighbors(u, [&](const State &v, [[maybe_unused]] const size_t step) {
+			stack.push_back(v);
+		});
+	}
+
+	return paths;
+}
+
+#endif
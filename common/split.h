@@ -0,0 +1,61 @@
+#if !defined(SPLIT_H)
+#define SPLIT_H
+
+#include <vector>		// std::vector
+#include <string>		// std::string
+#include <string_view>	// std::string_view
+
+#include "scan.h"
+
+/* The tokens are views into str until they are copied out, no strdup and
+ * no strtok (which is not reentrant either). Numbers come from scan.h.
+ */
+inline const std::vector<std::string> split_str(std::string_view str, std::string_view delims = ", =;") {
+    std::vector<std::string> tokens;
+
+    size_t start = str.find_first_not_of(delims);
+    while (start != std::string_view::npos) {
+        size_t end = str.find_first_of(delims, start);
+        tokens.emplace_back(str.substr(start, end - start));
+        start = str.find_first_not_of(delims, end);
+    }
+
+    return tokens;
+}
+
+inline const std::vector<int> split_int(std::string_view str, std::string_view delims = ", =;") {
+    std::vector<int> tokens;
+
+    int_scanner_t<int> scanner(str, delims);
+    int value;
+    while (scanner.next(value)) {
+        tokens.push_back(value);
+    }
+
+    return tokens;
+}
+
+inline const std::vector<size_t> split_size_t(std::string_view str, std::string_view delims = ", =;") {
+    std::vector<size_t> tokens;
+
+    int_scanner_t<size_t> scanner(str, delims);
+    size_t value;
+    while (scanner.next(value)) {
+        tokens.push_back(value);
+    }
+
+    return tokens;
+}
+
+template <typename T>
+std::ostream& operator<<(std::ostream& os, const std::vector<T> &v) {
+    for (auto it = v.begin(); it != v.end(); it++) {
+        if (it != v.begin()) {
+            os << ",";
+        }
+        os << *it;
+    }
+	return os;
+}
+
+#endif
@@ -11,13 +11,16 @@
 #include <algorithm>	// sort
 #include <numeric>		// max, reduce, etc.
 
+#include "input_view.h"
+#include "report.h"
+#include "batch.h"
+
 using namespace std;
 
 using data_t = vector<size_t>;
 using result_t = string;
 
 const data_t read_data(const string &filename);
-template <typename T> void print_result(T result, chrono::duration<double, milli> duration);
 
 
 /* Part 1 */
@@ -55,55 +58,25 @@ const result_t part2([[maybe_unused]] const data_t &data) {
 const data_t read_data(const string &filename) {
 	data_t data;
 
-	std::ifstream ifs(filename);
-
-	string line;
-	while (getline(ifs, line)) {
+	input_view_t input(filename);
+	for (const auto line : input.lines()) {
 		if (!line.empty()) {
-			data.push_back(stoul(line));
+			data.push_back(to_number<size_t>(line));
 		}
 	}
 
 	return data;
 }
 
-template <typename T>
-void print_result(T result, chrono::duration<double, milli> duration) {
-	const int time_width = 10;
-	const int time_precision = 4;
-	const int result_width = 15;
-
-	cout << std::setw(result_width) << std::right << result;
-
-	cout << " ("
-		 << std::setw(time_width) << std::fixed << std::right 
-		 << std::setprecision(time_precision)
-		 << duration.count() << "ms)";
-	cout << endl;
-}
-
+#if !defined(AOC_SOLVER)
 int main(int argc, char *argv[]) {
-	const char *input_file = argv[1];
-	if (argc < 2) {
-		input_file = "test.txt";
-	}
-
-    auto start_time = chrono::high_resolution_clock::now();
-
-	auto data = read_data(input_file);
-
-	auto parse_time = chrono::high_resolution_clock::now();
-	print_result("parse", (parse_time - start_time));
-
-	result_t p1_result = part1(data);
-
-	auto p1_time = chrono::high_resolution_clock::now();
-	print_result(p1_result, (p1_time - parse_time));
-
-	result_t p2_result = part2(data);
-
-	auto p2_time = chrono::high_resolution_clock::now();
-	print_result(p2_result, (p2_time - p1_time));
+	return day_main<read_data, part1, part2>(argc, argv);
+}
+#else
+#include "aoc_solver.h"
 
-	print_result("total", (p2_time - start_time));
+// entry point for libaoc, see aoc_solver.h
+AOC_EXPORT const aoc_solver_t *aoc_solver() {
+	return make_solver<read_data, part1, part2>(AOC_DAY);
 }
+#endif
@@ -10,11 +10,14 @@
 #include <ranges>		// ranges and views
 #include <algorithm>	// sort
 #include <numeric>		// max, reduce, etc.
-#include <unordered_set>
 #include <algorithm>
 
 #include "point.h"
+#include "flat_point.h"
 #include "charmap.h"
+#include "input_view.h"
+#include "report.h"
+#include "batch.h"
 
 using namespace std;
 
@@ -22,19 +25,15 @@ using data_t = charmap_t;
 using result_t = string;
 
 const data_t read_data(const string &filename);
-template <typename T> void print_result(T result, chrono::duration<double, milli> duration);
 
-point_t popset(unordered_set<point_t> &set) {
-	auto it = set.begin();
-	auto item = *it;
-	set.erase(it);
-	return item;
-}
+// map is bordered with this, it never increases or flashes
+const char border = '#';
 
 bool increase(const point_t &point, charmap_t &map) {
-	if (map.is_valid(point)) {
-		char value = map.get(point) + (char)1;
-		map.set(point, value);
+	char value = map.get_unchecked(point);
+	if (value != border) {
+		value++;
+		map.set_unchecked(point, value);
 		return value > '9';
 	}
 
@@ -43,41 +42,37 @@ bool increase(const point_t &point, charmap_t &map) {
 
 /* Iterate map through time steps and return number of flashes */
 size_t flash(charmap_t &map) {
-	unordered_set<point_t> flashed;	// points that have flashed this time
-	unordered_set<point_t> pending;	// points that need to flash
+	flat_point_set_t flashed;	// points that have flashed this time
+	vector<point_t> pending;	// points that need to flash, may repeat
 
 	// advance all points by time units and collect pending flashes
 	ranges::for_each(map.all_points(), [&map, &pending](const auto &p) {
-		auto &[point, value] = p;
-		if (increase(point, map)) {
-			pending.emplace(point);
+		if (increase(p, map)) {
+			pending.push_back(p);
 		}
 	});
 
 	// do the flashing
-	vector<point_t> all_directions = {
-		{-1, -1}, { 0, -1}, { 1, -1},
-		{-1,  0},           { 1,  0},
-		{-1,  1}, { 0,  1}, { 1,  1}
-	};
 	while (!pending.empty()) {
-		const point_t &flasher = popset(pending);
-		flashed.emplace(flasher);
+		const point_t flasher = pending.back();
+		pending.pop_back();
+		if (!flashed.insert(flasher)) {
+			continue;
+		}
 
-		for (auto dir : all_directions) {
-			point_t point = flasher + dir;
+		for (const auto &[point, value] : map.neighbors8(flasher)) {
 			if (increase(point, map) && !flashed.contains(point)) {
-				pending.emplace(point);
+				pending.push_back(point);
 			}
 		}
 	}
 
 	// reset all greater than 9 to 0
 	auto overflows = map.all_points() | 
-		views::filter([](const auto &p) { return p.second > '9'; });
+		views::filter([](const auto &p) { return p.w > '9'; });
 
 	ranges::for_each(overflows, [&map](const auto &p) {
-		map.set(p.first, '0');
+		map.set(p, '0');
 	});
 
 	return flashed.size();
@@ -99,7 +94,7 @@ const result_t part2(const data_t &start_map) {
 	size_t step = 0;
 	size_t flashes = 0;
 
-	while (flashes != (map.size_x * map.size_y)) {
+	while (flashes != static_cast<size_t>(map.size_x * map.size_y)) {
 		flashes = flash(map);
 		step++;
 	}
@@ -108,46 +103,21 @@ const result_t part2(const data_t &start_map) {
 }
 
 const data_t read_data(const string &filename) {
-	return charmap_t::from_file(filename);
-}
-
-template <typename T>
-void print_result(T result, chrono::duration<double, milli> duration) {
-	const int time_width = 10;
-	const int time_precision = 4;
-	const int result_width = 15;
-
-	cout << std::setw(result_width) << std::right << result;
-
-	cout << " ("
-		 << std::setw(time_width) << std::fixed << std::right 
-		 << std::setprecision(time_precision)
-		 << duration.count() << "ms)";
-	cout << endl;
+	input_view_t input(filename);
+	charmap_t map(input);
+	map.add_border(border);
+	return map;
 }
 
+#if !defined(AOC_SOLVER)
 int main(int argc, char *argv[]) {
-	const char *input_file = argv[1];
-	if (argc < 2) {
-		input_file = "test.txt";
-	}
-
-    auto start_time = chrono::high_resolution_clock::now();
-
-	auto data = read_data(input_file);
-
-	auto parse_time = chrono::high_resolution_clock::now();
-	print_result("parse", (parse_time - start_time));
-
-	result_t p1_result = part1(data);
-
-	auto p1_time = chrono::high_resolution_clock::now();
-	print_result(p1_result, (p1_time - parse_time));
-
-	result_t p2_result = part2(data);
-
-	auto p2_time = chrono::high_resolution_clock::now();
-	print_result(p2_result, (p2_time - p1_time));
+	return day_main<read_data, part1, part2>(argc, argv);
+}
+#else
+#include "aoc_solver.h"
 
-	print_result("total", (p2_time - start_time));
+// entry point for libaoc, see aoc_solver.h
+AOC_EXPORT const aoc_solver_t *aoc_solver() {
+	return make_solver<read_data, part1, part2>(AOC_DAY);
 }
+#endif
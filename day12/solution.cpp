@@ -11,11 +11,12 @@
 #include <algorithm>	// sort
 #include <numeric>		// max, reduce, etc.
 #include <unordered_map>
-#include <functional>
 #include <cctype>
-#include <unordered_set>
 
-#include "split.h"
+#include "search.h"
+#include "input_view.h"
+#include "report.h"
+#include "batch.h"
 
 using namespace std;
 
@@ -24,7 +25,6 @@ using data_t = unordered_map<string, vector<string>>;
 using result_t = string;
 
 const data_t read_data(const string &filename);
-template <typename T> void print_result(T result, chrono::duration<double, milli> duration);
 
 bool is_end_cave(const string &name) {
 	return name == "start" || name == "end";
@@ -38,105 +38,96 @@ bool is_small_cave(const string &name) {
 	return !is_big_cave(name);
 }
 
-bool in_path(const string &cave, const vector<string> &path) {
-	for (const auto &p : path) {
-		if (p == cave) {
-			return true;
-		}
+/* The cave map by index rather than name, so a path can be carried
+ * as the cave it is in plus a bit mask of small caves already visited. */
+struct cave_graph_t {
+	vector<vector<size_t>> neighbors = {};
+	vector<uint64_t> small_bit = {};	// 0 for big caves
+	size_t start = 0;
+	size_t end = 0;
+};
+
+/* Where a path is; current cave, small caves visited and if it 
+ * may still visit one small cave a second time. */
+struct path_state_t {
+	size_t cave;
+	uint64_t visited;
+	bool revisit;
+};
+
+cave_graph_t index_caves(const data_t &data) {
+	cave_graph_t graph;
+
+	unordered_map<string, size_t> index;
+	for (const auto &[cave, _] : data) {
+		index[cave] = index.size();
 	}
 
-	return false;
-}
+	assert(index.size() <= 64);
+	graph.neighbors.resize(index.size());
+	graph.small_bit.resize(index.size());
 
-/* Part 1 */
-const result_t part1(const data_t &data) {
-	vector<vector<string>> paths;
-
-	// breadth first search, collecting paths when we reach "end"
-	std::function<void(const data_t &, const string &, vector<string>)> bfs;
-	bfs = [&paths, &bfs](const data_t &cavemap, const string &current, vector<string> path) {
-		path.emplace_back(current);
-		if (current == "end") {
-			paths.emplace_back(path);
-			return;
+	for (const auto &[cave, neighbors] : data) {
+		const size_t i = index[cave];
+		graph.small_bit[i] = is_small_cave(cave) ? (uint64_t)1 << i : 0;
+		for (const auto &neighbor : neighbors) {
+			graph.neighbors[i].push_back(index[neighbor]);
 		}
+	}
+
+	graph.start = index["start"];
+	graph.end = index["end"];
+	return graph;
+}
 
-		// iterate over all neighbors of the current node (breadth first)
-		for (const auto &neighbor : cavemap.at(current)) {
-			if (!is_small_cave(neighbor) || !in_path(neighbor, path)) {
-				bfs(cavemap, neighbor, path);
+/* Count paths from start to end, visiting small caves at most once
+ * (and one of them twice when revisit is allowed). */
+size_t count_cave_paths(const data_t &data, bool revisit) {
+	const cave_graph_t graph = index_caves(data);
+
+	// moves along a path; no going back to start, small caves once
+	auto neighbors = [&graph](const path_state_t &path, auto &&emit) {
+		for (const auto cave : graph.neighbors[path.cave]) {
+			const uint64_t bit = graph.small_bit[cave];
+			if (cave == graph.start) {
+				continue;
+			} else if (!(path.visited & bit)) {
+				emit(path_state_t{cave, path.visited | bit, path.revisit}, 1);
+			} else if (path.revisit) {
+				emit(path_state_t{cave, path.visited, false}, 1);
 			}
 		}
 	};
-	
-	bfs(data, "start", {});
 
+	auto is_end = [&graph](const path_state_t &path) {
+		return path.cave == graph.end;
+	};
 
-	return to_string(paths.size());
+	const path_state_t start{graph.start, graph.small_bit[graph.start], revisit};
+	return count_paths(start, neighbors, is_end);
 }
 
-string flatten(const vector<string> &vec) {
-	string result;
-	for (const auto &s : vec) {
-		if (result.size()) {
-			result.append(",");
-		}
-		result.append(s);
-	}
-
-	return result;
+/* Part 1 */
+const result_t part1(const data_t &data) {
+	return to_string(count_cave_paths(data, false));
 }
 
 const result_t part2(const data_t &data) {
-	// maintain as set of strings for easy de-duplication
-	unordered_set<string> paths;
-
-	// breadth first search, collecting paths when we reach "end"
-	std::function<void(const data_t, const string &, const string &, vector<string>)> bfs;
-	bfs = [&paths, &bfs](const data_t cavemap, 
-							const string &current, const string &promoted, 
-							vector<string> path) {
-		path.emplace_back(current);
-		if (current == "end") {
-			paths.insert(flatten(path));
-			return;
-		}
-
-		// iterate over all neighbors of the current node (breadth first)
-		for (const auto &neighbor : cavemap.at(current)) {
-			if (is_big_cave(neighbor) || !in_path(neighbor, path)) {
-				bfs(cavemap, neighbor, promoted, path);
-			} else if (neighbor == promoted) {
-				bfs(cavemap, neighbor, "", path);
-			}
-		}
-	};
-	
-	for (const auto &[cave, neighbors] : data) {
-		if (is_small_cave(cave) && cave != "start" && cave != "end") {
-			bfs(data, "start", cave, {});
-		}
-	}
-
-	// for (const auto &path : paths) {
-	// 	cout << path << endl;
-	// }
-	return to_string(paths.size());
+	return to_string(count_cave_paths(data, true));
 }
 
 const data_t read_data(const string &filename) {
 	data_t data;
 
-	std::ifstream ifs(filename);
-
-	string line;
-	while (getline(ifs, line)) {
+	input_view_t input(filename);
+	for (const auto line : input.lines()) {
 		if (!line.empty()) {
-			auto nodes = split_str(line, "-");
-			assert(nodes.size() == 2);
+			// "start-A"
+			const size_t dash = line.find('-');
+			assert(dash != string_view::npos);
 
-			auto lhs = nodes[0];
-			auto rhs = nodes[1];
+			const string lhs{line.substr(0, dash)};
+			const string rhs{line.substr(dash + 1)};
 
 			data[lhs].emplace_back(rhs);
 			data[rhs].emplace_back(lhs);
@@ -146,43 +137,15 @@ const data_t read_data(const string &filename) {
 	return data;
 }
 
-template <typename T>
-void print_result(T result, chrono::duration<double, milli> duration) {
-	const int time_width = 10;
-	const int time_precision = 4;
-	const int result_width = 15;
-
-	cout << std::setw(result_width) << std::right << result;
-
-	cout << " ("
-		 << std::setw(time_width) << std::fixed << std::right 
-		 << std::setprecision(time_precision)
-		 << duration.count() << "ms)";
-	cout << endl;
-}
-
+#if !defined(AOC_SOLVER)
 int main(int argc, char *argv[]) {
-	const char *input_file = argv[1];
-	if (argc < 2) {
-		input_file = "test.txt";
-	}
-
-    auto start_time = chrono::high_resolution_clock::now();
-
-	auto data = read_data(input_file);
-
-	auto parse_time = chrono::high_resolution_clock::now();
-	print_result("parse", (parse_time - start_time));
-
-	result_t p1_result = part1(data);
-
-	auto p1_time = chrono::high_resolution_clock::now();
-	print_result(p1_result, (p1_time - parse_time));
-
-	result_t p2_result = part2(data);
-
-	auto p2_time = chrono::high_resolution_clock::now();
-	print_result(p2_result, (p2_time - p1_time));
+	return day_main<read_data, part1, part2>(argc, argv);
+}
+#else
+#include "aoc_solver.h"
 
-	print_result("total", (p2_time - start_time));
+// entry point for libaoc, see aoc_solver.h
+AOC_EXPORT const aoc_solver_t *aoc_solver() {
+	return make_solver<read_data, part1, part2>(AOC_DAY);
 }
+#endif
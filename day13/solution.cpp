@@ -7,39 +7,46 @@
 
 #include <vector>		// collectin
 #include <string>		// strings
+#include <string_view>	// font glyphs
 #include <ranges>		// ranges and views
 #include <algorithm>	// sort
 #include <numeric>		// max, reduce, etc.
-#include <unordered_set>
 
-#include "split.h"
 #include "point.h"
+#include "flat_point.h"
 #include "charmap.h"
+#include "input_view.h"
+#include "report.h"
+#include "batch.h"
 
 using namespace std;
 
-using map_t = unordered_set<point_t>;
-using fold_t = vector<point_t>;
+using map_t = flat_point_set_t;
+using fold_t = vector<point2_t>;
 using data_t = pair<map_t, fold_t>;
 
 using result_t = string;
 
 const data_t read_data(const string &filename);
-template <typename T> void print_result(T result, chrono::duration<double, milli> duration);
 
-map_t fold_points(const map_t &points, const point_t &fold) {
+/* verbosity level; 0 = nothing extra, 1 = the folded sheet. Set by command line. */
+static int verbose = 0;
+
+map_t fold_points(const map_t &points, const point2_t &fold) {
 	map_t folded;
+	folded.reserve(points.size());
 
-	for (const auto &point : points) {
+	for (const point_key_t &key : points) {
+		const point2_t point = key.to_point<point2_t>();
 		if (fold.y) {
 			if (point.y > fold.y) {
-				folded.insert({point.x, fold.y - (point.y - fold.y)});
+				folded.insert(point2_t{point.x, fold.y - (point.y - fold.y)});
 			} else {
 				folded.insert(point);
 			}
 		} else {
 			if (point.x > fold.x) {
-				folded.insert({fold.x - (point.x - fold.x), point.y});
+				folded.insert(point2_t{fold.x - (point.x - fold.x), point.y});
 			} else {
 				folded.insert(point);
 			}
@@ -76,6 +83,50 @@ map_t fold_points(const map_t &points, const point_t &fold) {
 // 	return map;
 // }
 
+/* The letters of the folded sheet, 4 dots wide and 6 tall, one every
+ * 5 columns. Each glyph is its 6 rows, left to right, top to bottom. */
+static const vector<pair<string_view, char>> font = {
+	{".##.#..##..######..##..#", 'A'}, {"###.#..####.#..##..####.", 'B'},
+	{".##.#..##...#...#..#.##.", 'C'}, {"#####...###.#...#...####", 'E'},
+	{"#####...###.#...#...#...", 'F'}, {".##.#..##...#.###..#.###", 'G'},
+	{"#..##..######..##..##..#", 'H'}, {".###..#...#...#...#..###", 'I'},
+	{"..##...#...#...##..#.##.", 'J'}, {"#..##.#.##..#.#.#.#.#..#", 'K'},
+	{"#...#...#...#...#...####", 'L'}, {".##.#..##..##..##..#.##.", 'O'},
+	{"###.#..##..####.#...#...", 'P'}, {"###.#..##..####.#.#.#..#", 'R'},
+	{".####...#....##....####.", 'S'}, {"#..##..##..##..##..#.##.", 'U'},
+	{"####...#..#..#..#...####", 'Z'},
+};
+
+// empty when the dots are not all letters
+string decode_letters(const map_t &points) {
+	int32_t width = 0;
+	for (const point_key_t &key : points) {
+		const point2_t point = key.to_point<point2_t>();
+		if (point.x < 0 || point.y < 0 || point.y >= 6 || point.x % 5 == 4) {
+			return "";
+		}
+		width = max(width, point.x + 1);
+	}
+
+	vector<string> glyphs(static_cast<size_t>(width + 4) / 5, string(24, '.'));
+	for (const point_key_t &key : points) {
+		const point2_t point = key.to_point<point2_t>();
+		glyphs[static_cast<size_t>(point.x / 5)][static_cast<size_t>(point.y * 4 + point.x % 5)] = '#';
+	}
+
+	string letters;
+	for (const auto &glyph : glyphs) {
+		const auto letter = find_if(font.begin(), font.end(), [&glyph](const auto &f) {
+			return f.first == glyph;
+		});
+		if (letter == font.end()) {
+			return "";
+		}
+		letters += letter->second;
+	}
+	return letters;
+}
+
 /* Part 1 */
 const result_t part1(const data_t &data) {
 	const auto &[points, folds] = data;
@@ -93,20 +144,36 @@ const result_t part2(const data_t &data) {
 		folded = fold_points(folded, fold);
 	}
 
-	charmap_t map = charmap_t::from_points(folded);
-	cout << map;
+	vector<point_t> pts{folded.begin(), folded.end()};
+	charmap_t map = charmap_t::from_points(pts);
+	if (verbose) {
+		cerr << map;
+	}
 
-	return to_string(0);
+	// the letters the dots spell out, or the sheet on one line if they are not letters
+	string letters = decode_letters(folded);
+	if (letters.empty()) {
+		for (dimension_t y = 0; y < map.size_y; y++) {
+			letters += (y ? "/" : "");
+			letters += map.row(y);
+		}
+	}
+	return letters;
 }
 
 const data_t read_data(const string &filename) {
-	std::ifstream ifs(filename);
+	input_view_t input(filename);
+	auto line = input.lines().begin();
 
-	auto points = read_points(ifs);
-	map_t map {points.begin(), points.end()};
+	auto points = read_points<point2_t>(line);
+	map_t map;
+	map.reserve(points.size());
+	for (const auto &point : points) {
+		map.insert(point);
+	}
 
-	fold_t folds = read_points(ifs, [](point_t &pt, const string &line) {
-		if (line.find("y=") != string::npos) {
+	fold_t folds = read_points<point2_t>(line, [](point2_t &pt, string_view fold) {
+		if (fold.find("y=") != string_view::npos) {
 			swap(pt.x, pt.y);
 		}
 	});
@@ -114,43 +181,15 @@ const data_t read_data(const string &filename) {
 	return {map, folds};
 }
 
-template <typename T>
-void print_result(T result, chrono::duration<double, milli> duration) {
-	const int time_width = 10;
-	const int time_precision = 4;
-	const int result_width = 15;
-
-	cout << std::setw(result_width) << std::right << result;
-
-	cout << " ("
-		 << std::setw(time_width) << std::fixed << std::right 
-		 << std::setprecision(time_precision)
-		 << duration.count() << "ms)";
-	cout << endl;
-}
-
+#if !defined(AOC_SOLVER)
 int main(int argc, char *argv[]) {
-	const char *input_file = argv[1];
-	if (argc < 2) {
-		input_file = "test.txt";
-	}
-
-    auto start_time = chrono::high_resolution_clock::now();
-
-	auto data = read_data(input_file);
-
-	auto parse_time = chrono::high_resolution_clock::now();
-	print_result("parse", (parse_time - start_time));
-
-	result_t p1_result = part1(data);
-
-	auto p1_time = chrono::high_resolution_clock::now();
-	print_result(p1_result, (p1_time - parse_time));
-
-	result_t p2_result = part2(data);
-
-	auto p2_time = chrono::high_resolution_clock::now();
-	print_result(p2_result, (p2_time - p1_time));
+	return day_main<read_data, part1, part2>(argc, argv, {{'v', [] { verbose++; }}});
+}
+#else
+#include "aoc_solver.h"
 
-	print_result("total", (p2_time - start_time));
+// entry point for libaoc, see aoc_solver.h
+AOC_EXPORT const aoc_solver_t *aoc_solver() {
+	return make_solver<read_data, part1, part2>(AOC_DAY);
 }
+#endif
@@ -13,7 +13,9 @@
 #include <unordered_map>
 #include <algorithm>
 
-#include "split.h"
+#include "input_view.h"
+#include "report.h"
+#include "batch.h"
 
 using namespace std;
 
@@ -22,7 +24,6 @@ using data_t = pair<string, rules_t>;
 using result_t = string;
 
 const data_t read_data(const string &filename);
-template <typename T> void print_result(T result, chrono::duration<double, milli> duration);
 
 template <typename Ta, typename Tb>
 size_t pair_hash(const Ta a, const Tb b) {
@@ -57,7 +58,7 @@ unordered_map<char, size_t> fast_fold(const string &pattern, size_t time, const
 
 		// Also increment the number (count) of those pairs that now exist.
 		// Add to the number of produced characters as well (these will be our result)
-		for (const auto [pair, count] : pairs) {
+		for (const auto &[pair, count] : pairs) {
 			if (rules.contains(pair)) {
 				auto [c1, c2] = pair_unhash(pair);
 				auto product = rules.at(pair);
@@ -101,60 +102,40 @@ const data_t read_data(const string &filename) {
 	string pattern;
 	rules_t rules;
 
-	std::ifstream ifs(filename);
+	input_view_t input(filename);
+	auto lines = input.lines();
+
+	auto line = lines.begin();
+	if (line != lines.end()) {
+		pattern = *line;
+
+		// "CH -> B"
+		for (++line; line != lines.end(); ++line) {
+			vector<string_view> parts;
+			for (const auto part : fields(*line)) {
+				parts.push_back(part);
+			}
 
-	if (getline(ifs, pattern)) {
-		string line;
-		while (getline(ifs, line)) {
-			auto parts = split(line);
 			if (parts.size() >= 3) {
 				auto pair = pair_hash(parts[0][0], parts[0][1]);
 				auto product = parts[2][0];
 				rules[pair] = product;
 			}
-		}	
+		}
 	}
 
 	return {pattern, rules};
 }
 
-template <typename T>
-void print_result(T result, chrono::duration<double, milli> duration) {
-	const int time_width = 10;
-	const int time_precision = 4;
-	const int result_width = 15;
-
-	cout << std::setw(result_width) << std::right << result;
-
-	cout << " ("
-		 << std::setw(time_width) << std::fixed << std::right 
-		 << std::setprecision(time_precision)
-		 << duration.count() << "ms)";
-	cout << endl;
-}
-
+#if !defined(AOC_SOLVER)
 int main(int argc, char *argv[]) {
-	const char *input_file = argv[1];
-	if (argc < 2) {
-		input_file = "test.txt";
-	}
-
-    auto start_time = chrono::high_resolution_clock::now();
-
-	auto data = read_data(input_file);
-
-	auto parse_time = chrono::high_resolution_clock::now();
-	print_result("parse", (parse_time - start_time));
-
-	result_t p1_result = part1(data);
-
-	auto p1_time = chrono::high_resolution_clock::now();
-	print_result(p1_result, (p1_time - parse_time));
-
-	result_t p2_result = part2(data);
-
-	auto p2_time = chrono::high_resolution_clock::now();
-	print_result(p2_result, (p2_time - p1_time));
+	return day_main<read_data, part1, part2>(argc, argv);
+}
+#else
+#include "aoc_solver.h"
 
-	print_result("total", (p2_time - start_time));
+// entry point for libaoc, see aoc_solver.h
+AOC_EXPORT const aoc_solver_t *aoc_solver() {
+	return make_solver<read_data, part1, part2>(AOC_DAY);
 }
+#endif
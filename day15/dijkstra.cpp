@@ -1,202 +1,291 @@
 
 #include <vector>
-#include <queue>
+#include <array>
+#include <algorithm>
+#include <limits>
+#include <cassert>
 #include <limits.h>
 
 #include "point.h"
 #include "charmap.h"
 #include "dijkstra.h"
-
-/* *** Dijkstra *** */
-
-// Directions we are allowed to go
-static std::vector<point_t> directions = {{0, 1}, {1, 0}, {0, -1}, {-1, 0}};
-
-// /* Returns true if we have an edge between from and to. */
-// static bool is_edge(const charmap_t &map, const vector_t &from, const vector_t &to) {
-// 	auto from_char = map.get(from.p);
-// 	auto to_char = map.get(to.p);
-// 	return to_char == 'z' || to_char >= from_char-1;
-// }
-
-// used to keep Q in cost (reverse) order. this one works :-)
-class compare_cost {
-	public:
-		bool operator() (vector_t &a, vector_t &b) {
-			return b.p.z < a.p.z;
-		}
-};
-
-// The cost to go from current to neighbor
-static size_t default_cost(const size_t cost, 
-				[[maybe_unused]] const vector_t &current, 
-				[[maybe_unused]] const vector_t &neighbor, 
-				[[maybe_unused]] const charmap_t &map) {
-	// return = current.p.z + 1; // ((direction == u.dir) ? 1 : 1001);
-	return cost + ((size_t)map.get(neighbor.p) - (size_t)'0');
-}
-
-// Have we reached the end?
-// bool is_end(const charmap_t &map, const vector_t &current) {
-// 	return current.p.x == map.size_x-1 && current.p.y == map.size_y-1;
-// }
-
-// Returns, min_cost, dist[], pred[]
-std::tuple<size_t, dist_t, pred_t>
-dijkstra(const charmap_t &map,
-		 const vector_t &start,
-		 const point_t &end,
-		 size_t (*cost_fn)(const size_t cost, const vector_t &current, 
-							const vector_t &neighbor, const charmap_t &map)) {
-	dist_t dist;
-	pred_t pred;
-	std::priority_queue<vector_t, std::vector<vector_t>, compare_cost> Q;
-
-	if (cost_fn == nullptr) {
-		cost_fn = default_cost;
+#include "probe.h"
+
+/* *** Dense grid Dijkstra *** */
+
+/* Shortest path over the cells of a bordered charmap, where entering a cell 
+ * costs its digit. Cells are addressed by charmap_t::index_of, neighbors 
+ * are +/- 1 and +/- stride away and the halo sentinel marks the edge.
+ *
+ * Step costs are 1..9 so the queue is Dial's bucket queue; a ring of 
+ * buckets where bucket f % ring holds cells with estimate f = cost + 
+ * heuristic. With a consistent heuristic that changes by at most 
+ * heuristic_step per move, a push lands 0..(9 + heuristic_step) past 
+ * the bucket being drained, so the ring is 10 + heuristic_step long.
+ */
+static probe_timer_t grid_search_time("grid_search");
+static probe_counter_t grid_relaxed("grid_search nodes relaxed");
+
+template <typename Heuristic>
+static std::tuple<size_t, grid_dist_t, grid_pred_t>
+grid_search(const charmap_t &map,
+			const point_t &start,
+			const point_t &end,
+			bool with_pred,
+			search_stats_t *stats,
+			Heuristic heuristic,
+			uint32_t heuristic_step) {
+	constexpr uint32_t unreached = std::numeric_limits<uint32_t>::max();
+	constexpr uint32_t max_step = 9;
+
+	assert(map.border);
+	probe_scope_t scope(grid_search_time);
+
+	grid_dist_t dist(map.data.size(), unreached);
+	grid_pred_t pred;
+	if (with_pred) {
+		pred.assign(map.data.size(), unreached);
 	}
 
-	Q.push(start);
-	dist[start] = 0;
+	const long stride = map.stride;
+	const std::array<long, 4> offsets = {-stride, 1, stride, -1};
+	const std::array<point_t, 4> steps = {{{0, -1}, {1, 0}, {0, 1}, {-1, 0}}};
+	const size_t target = map.index_of(end);
 
-	while (!Q.empty()) {
-		// u <= vertex in Q with min dist[u]
-		vector_t u = Q.top();
-		// remove u from Q
-		Q.pop();
+	std::vector<std::vector<uint32_t>> buckets(max_step + 1 + heuristic_step);
+	size_t queued = 1;
+	size_t expanded = 0;
 
-		size_t cost = static_cast<size_t>(u.p.z);
-		u.p.z = 0; // clear so we can insert into map properly
+	const size_t source = map.index_of(start);
+	dist[source] = 0;
+	buckets[heuristic(start) % buckets.size()].push_back(static_cast<uint32_t>(source));
 
-		// test if this node is the/an end node
-		if (u.p == end) {
-			return {cost, dist, pred};
-		}
-
-		// for each neighbor v of u in Q
-		for (auto direction : directions) {
-			vector_t v(u.p+direction, direction);
+	for (uint32_t f = heuristic(start); queued; f++) {
+		auto &bucket = buckets[f % buckets.size()];
 
-			size_t neighbor_cost = cost_fn(cost, u, v, map);
+		// by index, A* can push to the bucket we are draining
+		for (size_t k = 0; k < bucket.size(); k++) {
+			const uint32_t u = bucket[k];
+			const point_t up = map.point_of(u);
+			queued--;
 
-			// is neighbor(v) a valid move?
-			if (map.is_valid(v.p)) {
-				// is cost less than existing cost
-				if (dist.find(v) == dist.end() || neighbor_cost < dist[v]) {
-					dist[v] = neighbor_cost;
+			// stale; u was reached cheaper after this entry was queued
+			if (dist[u] + heuristic(up) != f) {
+				continue;
+			}
 
-					pred[v].clear();
-					pred[v].emplace_back(u);
+			if (u == target) {
+				if (stats) {
+					stats->expanded += expanded;
+				}
+				return {dist[u], std::move(dist), std::move(pred)};
+			}
 
-					v.p.z = static_cast<dimension_t>(neighbor_cost);
-					Q.push(v);
+			expanded++;
+			for (size_t n = 0; n < offsets.size(); n++) {
+				const size_t v = static_cast<size_t>(static_cast<long>(u) + offsets[n]);
+				const char ch = map.data[v];
+				if (ch == map.sentinel) {
+					continue;
+				}
 
-				} else if (neighbor_cost == dist[v]) {
-					pred[v].emplace_back(u);
+				const uint32_t cost = dist[u] + static_cast<uint32_t>(ch - '0');
+				if (cost < dist[v]) {
+					++grid_relaxed;
+					dist[v] = cost;
+					if (with_pred) {
+						pred[v] = u;
+					}
+
+					const uint32_t estimate = cost + heuristic(up + steps[n]);
+					buckets[estimate % buckets.size()].push_back(static_cast<uint32_t>(v));
+					queued++;
 				}
 			}
 		}
+
+		bucket.clear();
 	}
 
-	return {INT_MAX, dist, pred};
+	if (stats) {
+		stats->expanded += expanded;
+	}
+	return {INT_MAX, std::move(dist), std::move(pred)};
 }
 
-/* Return the distance of point p from the start using the precomputed dist[]. */
-size_t dijkstra_distance(const charmap_t &map, const dist_t &dist, const point_t &p) {
-	if (map.is_char(p.x, p.y, 'S')) {
+std::tuple<size_t, grid_dist_t, grid_pred_t>
+dijkstra_grid(const charmap_t &map,
+			  const point_t &start,
+			  const point_t &end,
+			  bool with_pred,
+			  search_stats_t *stats) {
+	auto no_heuristic = []([[maybe_unused]] const point_t &p) -> uint32_t {
 		return 0;
-	}
+	};
 
-	size_t distance = INT_MAX;
-	for (auto dir : directions) {
-		vector_t v{p.x, p.y, dir.x, dir.y};
-
-		auto dit = dist.find(v);
-		if (dit != dist.end()) {
-			size_t d = dit->second;
-			if (d && d < distance) {
-				distance = d;
-			}
-		}
+	return grid_search(map, start, end, with_pred, stats, no_heuristic, 0);
+}
 
-	}
-	return distance;
+/* A* version of dijkstra_grid, guided by manhattan distance to end
+ * times the cheapest step on the map. */
+std::tuple<size_t, grid_dist_t, grid_pred_t>
+astar_grid(const charmap_t &map,
+		   const point_t &start,
+		   const point_t &end,
+		   bool with_pred,
+		   search_stats_t *stats) {
+	const manhattan_heuristic_t heuristic{end, min_step_cost(map)};
+	auto to_end = [&heuristic](const point_t &p) {
+		return static_cast<uint32_t>(heuristic(p));
+	};
+
+	return grid_search(map, start, end, with_pred, stats, to_end, 
+					   static_cast<uint32_t>(heuristic.min_cost));
 }
 
-/* Return the path from start to end using precomputed pred. */
-std::vector<point_t> dijkstra_path(const point_t &end, const pred_t &pred) {
-	std::vector<point_t> path;
-	std::queue<vector_t> Q;
+/* One side of bidirectional_grid; distances and a bucket ring 
+ * drained a whole level (distance) at a time. */
+struct grid_frontier_t {
+	grid_dist_t dist;
+	std::array<std::vector<uint32_t>, 10> buckets = {};
+	uint32_t level = 0;
+	size_t queued = 0;
 
-	// look backwards in all directions
-	for (auto direction : directions) {
-		Q.push({end, direction});
+	explicit grid_frontier_t(size_t cells) : 
+		dist(cells, std::numeric_limits<uint32_t>::max()) {
 	}
 
-	// run backwards looking for all the tiles we hit.
-	while (!Q.empty()) {
-		auto vertex = Q.front();
-		Q.pop();
+	void push(size_t cell, uint32_t cost) {
+		dist[cell] = cost;
+		buckets[cost % buckets.size()].push_back(static_cast<uint32_t>(cell));
+		queued++;
+	}
 
+	// move level up to the cheapest queued distance
+	void next_level() {
+		while (queued && buckets[level % buckets.size()].empty()) {
+			level++;
+		}
+	}
+};
 
-		if (!path.size() || path.back() != vertex.p) {
-			path.push_back(vertex.p);
+/* Expand every cell at the current level of from, meeting cells already
+ * reached by other update best. Forward, a step costs the digit entered; 
+ * backward (reverse) a step costs the digit being left. */
+static size_t expand_level(const charmap_t &map, grid_frontier_t &from,
+						   const grid_frontier_t &other, bool backward, 
+						   uint32_t &best) {
+	const long stride = map.stride;
+	const std::array<long, 4> offsets = {-stride, 1, stride, -1};
+
+	size_t expanded = 0;
+	auto &bucket = from.buckets[from.level % from.buckets.size()];
+	for (const auto u : bucket) {
+		from.queued--;
+
+		// stale; u was reached cheaper after this entry was queued
+		if (from.dist[u] != from.level) {
+			continue;
 		}
 
-		auto pit = pred.find(vertex);
-		if (pit != pred.end()) {
-			std::vector<vector_t> p = pit->second;
-			for (const auto &predecessor : p) {
-				Q.push(predecessor);
+		expanded++;
+		for (const auto offset : offsets) {
+			const size_t v = static_cast<size_t>(static_cast<long>(u) + offset);
+			const char ch = map.data[v];
+			if (ch == map.sentinel) {
+				continue;
+			}
+
+			const char step = backward ? map.data[u] : ch;
+			const uint32_t cost = from.level + static_cast<uint32_t>(step - '0');
+			if (cost < from.dist[v]) {
+				from.push(v, cost);
+
+				if (other.dist[v] != std::numeric_limits<uint32_t>::max()) {
+					best = std::min(best, cost + other.dist[v]);
+				}
 			}
 		}
 	}
 
-	return path;
+	bucket.clear();
+	from.level++;
+	return expanded;
 }
 
-void show_dijkstra_distances(const charmap_t &map, const dist_t &dist) {
-	int x_width = 4;
+/* Point to point shortest path on a bordered map searched from both ends.
+ * Always grows the side with less queued. Once the two cheapest queued 
+ * distances add up to the best meeting found, nothing left can beat it.
+ * Returns the cost only, INT_MAX if end cannot be reached. */
+size_t bidirectional_grid(const charmap_t &map,
+						  const point_t &start,
+						  const point_t &end,
+						  search_stats_t *stats) {
+	assert(map.border);
+
+	grid_frontier_t forward(map.data.size());
+	grid_frontier_t backward(map.data.size());
+	forward.push(map.index_of(start), 0);
+	backward.push(map.index_of(end), 0);
+
+	uint32_t best = start == end ? 0 : std::numeric_limits<uint32_t>::max();
+	size_t expanded = 0;
+
+	while (forward.queued && backward.queued) {
+		forward.next_level();
+		backward.next_level();
+
+		if (best != std::numeric_limits<uint32_t>::max() && forward.level + backward.level >= best) {
+			break;
+		}
 
-	std::cout << "   ";
-	for (dimension_t x = 0; x < map.size_x; ++x) {
-		std::cout << std::setw(x_width) << x;
+		if (forward.queued <= backward.queued) {
+			expanded += expand_level(map, forward, backward, false, best);
+		} else {
+			expanded += expand_level(map, backward, forward, true, best);
+		}
 	}
-	std::cout << "\n";
 
-	std::cout << "-+-";
-	for (dimension_t x = 0; x < map.size_x; ++x) {
-		std::cout << "---";
+	if (stats) {
+		stats->expanded += expanded;
 	}
-	std::cout << "-+-\n";
 
+	return best == std::numeric_limits<uint32_t>::max() ? INT_MAX : best;
+}
 
-	size_t y = 0;
-	for (auto yit = map.data.begin(); yit != map.data.end(); ++yit) {
-		std::cout << y % 10 << "| ";
+/* Cheapest step on the map, the smallest digit */
+size_t min_step_cost(const charmap_t &map) {
+	char min_ch = '9';
+	for (dimension_t y = 0; y < map.size_y; y++) {
+		for (const auto ch : map.row(y)) {
+			min_ch = std::min(min_ch, ch);
+		}
+	}
 
-		size_t x = 0;
-		for (auto xit = (*yit).begin(); xit != (*yit).end(); ++xit) {
-			size_t distance = dijkstra_distance(map, dist, {x, y});
-			if (distance < INT_MAX) {
-				std::cout << std::setw(x_width) << dijkstra_distance(map, dist, {x, y});
-			} else {
-				std::cout << std::setw(x_width) << " ";
-			}
+	return (size_t)min_ch - (size_t)'0';
+}
 
-			x++;
-		}
-		std::cout << " |" << std::setw(x_width) << y << "\n";
-		++y;
+/* Return the path from start to end (inclusive) using pred from dijkstra_grid. */
+std::vector<point_t> dijkstra_path(const charmap_t &map, const point_t &start, 
+								   const point_t &end, const grid_pred_t &pred) {
+	std::vector<point_t> path;
+	if (pred.empty()) {
+		return path;
 	}
 
-	std::cout << "-+-";
-	for (dimension_t x = 0; x < map.size_x; ++x) {
-		std::cout << "---";
+	const size_t source = map.index_of(start);
+	size_t i = map.index_of(end);
+	while (i != source && pred[i] != std::numeric_limits<uint32_t>::max()) {
+		path.push_back(map.point_of(i));
+		i = pred[i];
 	}
-	std::cout << "-+-\n   ";
-	for (dimension_t x = 0; x < map.size_x; ++x) {
-		std::cout << std::setw(x_width) << x;
+
+	if (i == source) {
+		path.push_back(start);
+		std::reverse(path.begin(), path.end());
+	} else {
+		path.clear();
 	}
-	std::cout << "\n";
+
+	return path;
 }
@@ -3,27 +3,56 @@
 #define DIJKSTRA_H
 
 #include <vector>
-#include <map>
+#include <tuple>
+#include <cstdint>
 
 #include "point.h"
-#include "vector.h"
 #include "charmap.h"
+#include "search.h"
 
-// dijkstra types, code below
-using dist_t = std::map<vector_t, size_t>;
-using pred_t = std::map<vector_t, std::vector<vector_t>>;
+/* Admissible heuristic for A* on grids; manhattan distance to end times 
+ * the cheapest step, so never more than the real cost. */
+struct manhattan_heuristic_t {
+	point_t end;
+	size_t min_cost = 1;
 
-// Returns, min_cost, dist[], pred[]
-std::tuple<size_t, dist_t, pred_t> dijkstra(
+	size_t operator()(const point_t &p) const {
+		return static_cast<size_t>(manhattan_distance(p, end)) * min_cost;
+	}
+};
+
+// cheapest step on the map, the smallest digit
+size_t min_step_cost(const charmap_t &map);
+
+// dense grid dijkstra types, indexed by charmap_t::index_of()
+using grid_dist_t = std::vector<uint32_t>;
+using grid_pred_t = std::vector<uint32_t>;
+
+// Returns, min_cost, dist[], pred[] (empty unless with_pred)
+// map needs add_border(), cells are step costs '1'..'9'
+std::tuple<size_t, grid_dist_t, grid_pred_t> dijkstra_grid(
+	const charmap_t &map,
+	const point_t &start,
+	const point_t &end,
+	bool with_pred = false,
+	search_stats_t *stats = nullptr);
+
+// as dijkstra_grid, A* with manhattan_heuristic_t
+std::tuple<size_t, grid_dist_t, grid_pred_t> astar_grid(
+	const charmap_t &map,
+	const point_t &start,
+	const point_t &end,
+	bool with_pred = false,
+	search_stats_t *stats = nullptr);
+
+// cost only, searching from both start and end at once
+size_t bidirectional_grid(
 	const charmap_t &map,
-	const vector_t &start,
+	const point_t &start,
 	const point_t &end,
-	size_t (*cost_fn)(const size_t cost, 
-		const vector_t &current, const vector_t &neighbor, 
-		const charmap_t &map) = nullptr);
+	search_stats_t *stats = nullptr);
 
-size_t dijkstra_distance(const charmap_t &map, const dist_t &dist, const point_t &p);
-std::vector<point_t> dijkstra_path(const point_t &end, const pred_t &pred);
-void show_dijkstra_distances(const charmap_t &map, const dist_t &dist);
+std::vector<point_t> dijkstra_path(const charmap_t &map, const point_t &start, 
+	const point_t &end, const grid_pred_t &pred);
 
 #endif
@@ -13,7 +13,10 @@
 
 #include "point.h"
 #include "charmap.h"
+#include "input_view.h"
 #include "dijkstra.h"
+#include "report.h"
+#include "batch.h"
 
 using namespace std;
 
@@ -21,17 +24,34 @@ using data_t = charmap_t;
 using result_t = string;
 
 const data_t read_data(const string &filename);
-template <typename T> void print_result(T result, chrono::duration<double, milli> duration);
 
+// maps are bordered with this so dijkstra_grid can skip bounds checks
+const char border = '#';
 
-/* Part 1 */
-const result_t part1(const data_t &map) {
+/* verbosity level; 0 = nothing extra, 1 = nodes expanded. Set by command line. */
+static int verbose = 0;
 
-	const vector_t start({0, 0}, {0, 0});
+/* Lowest total risk from top left to bottom right of the map.
+ * astar_grid and bidirectional_grid give the same cost but are no 
+ * faster here (see the README); tests/day15_search_test checks that. */
+size_t lowest_risk(const charmap_t &map) {
+	const point_t start(0, 0);
 	const point_t end(map.size_x-1, map.size_y-1);
 
-	auto [cost, dist, pred] = dijkstra(map, start, end);
-	return to_string(cost);
+	search_stats_t stats;
+	auto [cost, dist, pred] = dijkstra_grid(map, start, end, false, &stats);
+
+	if (verbose) {
+		cerr << "dijkstra expanded " << stats.expanded << endl;
+	}
+
+	return cost;
+}
+
+
+/* Part 1 */
+const result_t part1(const data_t &map) {
+	return to_string(lowest_risk(map));
 }
 
 /* Return the source map multipled out dx and dy with new locations 
@@ -55,60 +75,31 @@ charmap_t multiply(const charmap_t &map, size_t dx, size_t dy) {
 		bigmap.set(p, value);
 	}
 
+	bigmap.add_border(border);
 	return bigmap;
 }
 
 const result_t part2(const data_t &map) {
 	const auto bigmap = multiply(map, 5, 5);
-
-	const vector_t start({0, 0}, {0, 0});
-	const point_t end(bigmap.size_x-1, bigmap.size_y-1);
-
-	auto [cost, dist, pred] = dijkstra(bigmap, start, end);
-	return to_string(cost);
+	return to_string(lowest_risk(bigmap));
 }
 
 const data_t read_data(const string &filename) {
-	return charmap_t::from_file(filename);
-}
-
-template <typename T>
-void print_result(T result, chrono::duration<double, milli> duration) {
-	const int time_width = 10;
-	const int time_precision = 4;
-	const int result_width = 15;
-
-	cout << std::setw(result_width) << std::right << result;
-
-	cout << " ("
-		 << std::setw(time_width) << std::fixed << std::right 
-		 << std::setprecision(time_precision)
-		 << duration.count() << "ms)";
-	cout << endl;
+	input_view_t input(filename);
+	charmap_t map(input);
+	map.add_border(border);
+	return map;
 }
 
+#if !defined(AOC_SOLVER)
 int main(int argc, char *argv[]) {
-	const char *input_file = argv[1];
-	if (argc < 2) {
-		input_file = "test.txt";
-	}
-
-    auto start_time = chrono::high_resolution_clock::now();
-
-	auto data = read_data(input_file);
-
-	auto parse_time = chrono::high_resolution_clock::now();
-	print_result("parse", (parse_time - start_time));
-
-	result_t p1_result = part1(data);
-
-	auto p1_time = chrono::high_resolution_clock::now();
-	print_result(p1_result, (p1_time - parse_time));
-
-	result_t p2_result = part2(data);
-
-	auto p2_time = chrono::high_resolution_clock::now();
-	print_result(p2_result, (p2_time - p1_time));
+	return day_main<read_data, part1, part2>(argc, argv, {{'v', [] { verbose++; }}});
+}
+#else
+#include "aoc_solver.h"
 
-	print_result("total", (p2_time - start_time));
+// entry point for libaoc, see aoc_solver.h
+AOC_EXPORT const aoc_solver_t *aoc_solver() {
+	return make_solver<read_data, part1, part2>(AOC_DAY);
 }
+#endif
@@ -11,45 +11,72 @@
 #include <algorithm>	// sort
 #include <numeric>		// max, reduce, etc.
 #include <unordered_map>
-#include <unordered_set>
+#include <optional>		// merge_scanners may fail
 #include <print>
 
 #include "point.h"
+#include "point_cloud.h"
+#include "flat_point.h"
+#include "probe.h"
+#include "input_view.h"
+#include "report.h"
+#include "batch.h"
 
 using namespace std;
 
+// where another scanner is relative to this one, w is the rotation index
+using xform_t = valued_point_t<point3_t, uint8_t>;
+
+using cloud_t = point_cloud_t<point3_t>;
+
 struct scanner_t {
 	uint64_t id;
-	vector<point_t> points;
+	cloud_t points;
+
+	// same beacons again for membership tests in matching_points()
+	flat_point_set_t beacons = {};
 
 	// map of beacon pairs at each distance; distance -> { <beacon, beacon>, {},... }
-	unordered_map<uint64_t, vector<pair<point_t, point_t>>> distances = {};
+	unordered_map<uint64_t, vector<pair<point3_t, point3_t>>> distances = {};
 
 	// location of all scanners merged into this scanner
-	vector<point_t> scanners = {{0, 0, 0}};
+	vector<point3_t> scanners = {{0, 0, 0}};
 
-	scanner_t(const uint64_t n, const vector<point_t> &points) : id(n), points(points) {
-		set_distances();
+	scanner_t(const uint64_t n, const vector<point3_t> &points) : id(n), points(points) {
+		add_distances(0);
 	}
 
-	void set_points(const vector<point_t> &points) {
-		this->points = points;
-		set_distances();
+	// take in the beacons of moved that aren't already here
+	void add_points(const cloud_t &moved) {
+		const size_t known = points.size();
+		for (size_t i = 0; i < moved.size(); i++) {
+			const point3_t p = moved[i];
+			if (!beacons.contains(p)) {
+				points.push_back(p);
+			}
+		}
+		add_distances(known);
 	}
 
 	void clear_points() {
 		this->points.clear();
+		this->beacons.clear();
 		this->distances.clear();
 	}
 
 	private:
-	void set_distances() {
-		// create map of distance -> points
-		this->distances.clear();
-		for (size_t i = 0; i < points.size(); i++) {
-			for (size_t j = i+1; j < points.size(); j++) {
-				auto d = manhattan_distance(points[i], points[j]);
-				this->distances[(uint64_t)d].push_back({points[i], points[j]});
+	// distance -> points for the points from first on against all the points
+	// before them, straight off the coordinate arrays. A merge only adds the
+	// new beacons' pairs, the pairs already here stay.
+	void add_distances(const size_t first) {
+		const auto &x = points.x;
+		const auto &y = points.y;
+		const auto &z = points.z;
+		for (size_t i = first; i < points.size(); i++) {
+			this->beacons.insert(points[i]);
+			for (size_t j = 0; j < i; j++) {
+				auto d = abs(x[i] - x[j]) + abs(y[i] - y[j]) + abs(z[i] - z[j]);
+				this->distances[(uint64_t)d].push_back({points[j], points[i]});
 			}
 		}
 	}
@@ -59,7 +86,6 @@ using data_t = vector<scanner_t>;
 using result_t = string;
 
 const data_t read_data(const string &filename);
-template <typename T> void print_result(T result, chrono::duration<double, milli> duration);
 
 
 size_t distance_matches(const scanner_t &s1, const scanner_t &s2) {
@@ -75,7 +101,7 @@ size_t distance_matches(const scanner_t &s1, const scanner_t &s2) {
 
 // 24 different possible rotations around x, y, and z axes
 // try each one and use the index for transformation.
-vector<vector<point_t>> rotations = {
+vector<vector<point3_t>> rotations = {
 	{{ 1,  0,  0}, { 0,  1,  0}, { 0,  0,  1}},
 	{{ 0,  0,  1}, { 0,  1,  0}, {-1,  0,  0}},
 	{{-1,  0,  0}, { 0,  1,  0}, { 0,  0, -1}},
@@ -107,39 +133,24 @@ vector<vector<point_t>> rotations = {
 	{{ 0,  1,  0}, { 0,  0,  1}, { 1,  0,  0}},
 };
 
-point_t rotate(const point_t &p, const size_t n) {
-	point_t result;
-    vector<point_t> rot = rotations[n];
+point3_t rotate(const point3_t &p, const size_t n) {
+	point3_t result;
+    vector<point3_t> rot = rotations[n];
     result.x = p.x * rot[0].x + p.y * rot[0].y + p.z * rot[0].z;
     result.y = p.x * rot[1].x + p.y * rot[1].y + p.z * rot[1].z;
     result.z = p.x * rot[2].x + p.y * rot[2].y + p.z * rot[2].z;
     return result;
 }
 
-point_t transform_point(const point_t &p, const point_t &xform) {
-	return rotate(p, (uint64_t)xform.w) + xform;
-}
-
-vector<point_t> transform_points(const vector<point_t> &points, point_t &xform) {
-	auto transformer = [&xform](const point_t &p) {
-		return transform_point(p, xform);
-	};
-
-	return points | 
-			views::transform(transformer) |
-			ranges::to<vector<point_t>>();
+point3_t transform_point(const point3_t &p, const xform_t &xform) {
+	return rotate(p, xform.w) + xform;
 }
 
-void merge_scanners(scanner_t &s1, scanner_t &s2, point_t &xform) {
-	unordered_set<point_t> points{s1.points.begin(), s1.points.end()};
-
-	auto s2_points = transform_points(s2.points, xform);
-	points.insert(s2_points.begin(), s2_points.end());
-
-	vector<point_t> v_points{points.begin(), points.end()};
-
-	s1.points.clear();
-	s1.set_points(v_points);
+void merge_scanners(scanner_t &s1, scanner_t &s2, const xform_t &xform) {
+	// whole cloud at once, see transform_point
+	cloud_t moved = s2.points;
+	moved.transform(rotations[xform.w], xform);
+	s1.add_points(moved);
 	s2.clear_points();
 
 	// update scanners that have been merged here
@@ -148,31 +159,62 @@ void merge_scanners(scanner_t &s1, scanner_t &s2, point_t &xform) {
 	}
 }
 
-size_t matching_points(const scanner_t &s1, const scanner_t &s2, point_t &xform) {
-	auto p1 = s1.points;
-	sort(p1.begin(), p1.end());
-
-	auto p2 = transform_points(s2.points, xform);
-	sort(p2.begin(), p2.end());
-
-	vector<point_t> common;
-	set_intersection(p1.begin(), p1.end(), p2.begin(), p2.end(), back_inserter(common));
+static probe_timer_t merge_time("day19 merge_scanners");
+static probe_counter_t align_attempts("day19 alignment attempts");
+static probe_counter_t align_calls("day19 align calls");
+
+// how many of s2's beacons land on one of s1's once moved by xform. The
+// move is one vectorized transform over a copy of s2's coordinate arrays
+// in moved, which the caller keeps so its memory is reused
+size_t matching_points(const scanner_t &s1, const scanner_t &s2, const xform_t &xform, cloud_t &moved) {
+	moved = s2.points;
+	moved.transform(rotations[xform.w], xform);
+
+	size_t common = 0;
+	for (size_t i = 0; i < moved.size(); i++) {
+		if (s1.beacons.contains(moved[i])) {
+			common++;
+		}
+	}
 
-	return common.size();
+	return common;
 }
 
-point_t align(const scanner_t &s1, const scanner_t &s2, size_t coincident_points) {
-	point_t offset;
-
-	// pairs of pairs of points that have the same distance
+xform_t align(const scanner_t &s1, const scanner_t &s2, size_t coincident_points) {
+	++align_calls;
+
+	/* pairs of pairs of points that have the same distance, s1's first.
+	 * The distance only has to be unique in the smaller scanner; the other
+	 * one may hold many merged scanners and few of its distances are unique
+	 * any more, so each of its pairs at that distance is tried, both ways
+	 * round.
+	 *
+	 * This finds whatever requiring both to be unique found. A distance
+	 * unique in both is unique in the smaller, and its one pair in the
+	 * larger is among those tried, both ways round. The extra pairs cost
+	 * attempts but cannot merge wrongly: a transform is only taken once
+	 * matching_points() lands coincident_points beacons, which the puzzle
+	 * promises only the real overlap does. On real inputs, squared
+	 * distances within one scanner's ~26 beacons are nearly all unique,
+	 * so the smaller side always has some of the 66 pairs of 12 shared
+	 * beacons to go on. */
 	auto distance_pairs = [&s1, &s2]() {
-		vector<pair<pair<point_t, point_t>, pair<point_t, point_t>>> d_pairs;
-
-		for (const auto &[d, d1] : s1.distances) {
-			if (s2.distances.contains(d)) {
-				auto d2 = s2.distances.at(d);
-				if (d1.size() == 1 && d2.size() == 1) {
-					d_pairs.push_back({d1[0], d2[0]});
+		vector<pair<pair<point3_t, point3_t>, pair<point3_t, point3_t>>> d_pairs;
+
+		const bool s2_smaller = s2.points.size() <= s1.points.size();
+		const scanner_t &small = s2_smaller ? s2 : s1;
+		const scanner_t &large = s2_smaller ? s1 : s2;
+		for (const auto &[d, unique] : small.distances) {
+			const auto many = large.distances.find(d);
+			if (unique.size() == 1 && many != large.distances.end()) {
+				for (const auto &[a, b] : many->second) {
+					for (const auto &other : {pair{a, b}, pair{b, a}}) {
+						if (s2_smaller) {
+							d_pairs.push_back({other, unique[0]});
+						} else {
+							d_pairs.push_back({unique[0], other});
+						}
+					}
 				}
 			}
 		}
@@ -180,20 +222,22 @@ point_t align(const scanner_t &s1, const scanner_t &s2, size_t coincident_points
 		return d_pairs;
 	};
 
+	cloud_t moved;
+
 	for (const auto &[p1, p2] : distance_pairs()) {
 		// translate to "origins" (based on chosen point)
-		point_t p1_relative = p1.second - p1.first;
-		point_t p2_relative = p2.second - p2.first;
+		point3_t p1_relative = p1.second - p1.first;
+		point3_t p2_relative = p2.second - p2.first;
 
 		// check all 24 rotations
 		// for rotated "p" from p2_relative is the same as in s1 space (p1)
 		for (size_t r = 0; r < rotations.size(); r++) {
-			point_t p = rotate(p2_relative, r);
+			point3_t p = rotate(p2_relative, r);
 			if (p == p1_relative) {
-				point_t check = p1.first - rotate(p2.first, r);
-				check.w = (dimension_t)r;
+				xform_t check{p1.first - rotate(p2.first, r), static_cast<uint8_t>(r)};
+				++align_attempts;
 
-				if (coincident_points <= matching_points(s1, s2, check)) {
+				if (coincident_points <= matching_points(s1, s2, check, moved)) {
 					return check;
 				}
 			}
@@ -220,19 +264,29 @@ vector<pair<scanner_t &, scanner_t &>> scanner_pairs(vector<scanner_t> &scanners
 	return pairs;
 }
 
-scanner_t merge_scanners(const data_t &data, size_t conicident_points) {
+/* All the scanners merged into one, nothing when a pass goes by without a
+ * merge; then some scanners share too few beacons with the rest. */
+optional<scanner_t> merge_scanners(const data_t &data, size_t conicident_points) {
+	probe_scope_t scope(merge_time);
 	auto scanners = data;
 	size_t required_matches = (conicident_points * (conicident_points + 1)) / 2;
 
 	int active_scanners = (int)scanners.size();
-	while (active_scanners > 1) {
+	if (active_scanners == 1) {
+		return scanners[0];
+	}
+
+	bool merged = true;
+	while (active_scanners > 1 && merged) {
+		merged = false;
 
 		for (auto &[s1, s2] : scanner_pairs(scanners)) {
 			if (required_matches < distance_matches(s1, s2)) {
-				point_t offset = align(s1, s2, conicident_points);
+				xform_t offset = align(s1, s2, conicident_points);
 				if (offset.x != 0) {
 					// println("merge {} + {} : common={} xform={},r={}", s1.id, s2.id, common, offset, offset.w);
 					merge_scanners(s1, s2, offset);
+					merged = true;
 					if (--active_scanners == 1) {
 						return s1;
 					}
@@ -241,23 +295,36 @@ scanner_t merge_scanners(const data_t &data, size_t conicident_points) {
 		}
 	}
 
-	return scanner_t(0, {});
+	cerr << "day19: scanners";
+	for (const auto &scanner : scanners) {
+		if (scanner.points.size() != 0) {
+			cerr << " " << scanner.id;
+		}
+	}
+	cerr << " never merged" << endl;
+	return nullopt;
 }
 
 
 /* Part 1 */
 const result_t part1(const data_t &data) {
-	scanner_t ocean = merge_scanners(data, 12);
+	const auto ocean = merge_scanners(data, 12);
+	if (!ocean) {
+		return "";
+	}
 
-	return to_string(ocean.points.size());
+	return to_string(ocean->points.size());
 }
 
 const result_t part2(const data_t &data) {
-	scanner_t ocean = merge_scanners(data, 12);
+	const auto ocean = merge_scanners(data, 12);
+	if (!ocean) {
+		return "";
+	}
 
 	// find max distance among any two scanners in the one remaining scanner
 	size_t max_distance = 0;
-	auto scanners = ocean.scanners;
+	const auto &scanners = ocean->scanners;
 	for (size_t i = 0; i < scanners.size(); i++) {
 		for (size_t j = i; j < scanners.size(); j++) {
 			size_t dist = (size_t)manhattan_distance(scanners[i], scanners[j]);
@@ -271,14 +338,12 @@ const result_t part2(const data_t &data) {
 const data_t read_data(const string &filename) {
 	data_t data;
 
-	std::ifstream ifs(filename);
+	input_view_t input(filename);
 
-	string line;
 	uint64_t scanner_n = 0;
-	vector<point_t> scanner;
-	while (getline(ifs, line)) {
-		if (line.starts_with("---")) {
-			scanner_t scanner(scanner_n++, read_points(ifs));
+	for (auto line = input.lines().begin(); line != std::default_sentinel; ) {
+		if ((*line++).starts_with("---")) {
+			scanner_t scanner(scanner_n++, read_points<point3_t>(line));
 			data.push_back(scanner);
 		}
 	}
@@ -286,43 +351,15 @@ const data_t read_data(const string &filename) {
 	return data;
 }
 
-template <typename T>
-void print_result(T result, chrono::duration<double, milli> duration) {
-	const int time_width = 10;
-	const int time_precision = 4;
-	const int result_width = 15;
-
-	cout << std::setw(result_width) << std::right << result;
-
-	cout << " ("
-		 << std::setw(time_width) << std::fixed << std::right 
-		 << std::setprecision(time_precision)
-		 << duration.count() << "ms)";
-	cout << endl;
-}
-
+#if !defined(AOC_SOLVER)
 int main(int argc, char *argv[]) {
-	const char *input_file = argv[1];
-	if (argc < 2) {
-		input_file = "test.txt";
-	}
-
-    auto start_time = chrono::high_resolution_clock::now();
-
-	auto data = read_data(input_file);
-
-	auto parse_time = chrono::high_resolution_clock::now();
-	print_result("parse", (parse_time - start_time));
-
-	result_t p1_result = part1(data);
-
-	auto p1_time = chrono::high_resolution_clock::now();
-	print_result(p1_result, (p1_time - parse_time));
-
-	result_t p2_result = part2(data);
-
-	auto p2_time = chrono::high_resolution_clock::now();
-	print_result(p2_result, (p2_time - p1_time));
+	return day_main<read_data, part1, part2>(argc, argv);
+}
+#else
+#include "aoc_solver.h"
 
-	print_result("total", (p2_time - start_time));
+// entry point for libaoc, see aoc_solver.h
+AOC_EXPORT const aoc_solver_t *aoc_solver() {
+	return make_solver<read_data, part1, part2>(AOC_DAY);
 }
+#endif
@@ -10,21 +10,26 @@
 #include <ranges>		// ranges and views
 #include <algorithm>	// sort
 #include <numeric>		// max, reduce, etc.
-#include <unordered_set>
 #include <print>
 
 #include "point.h"
+#include "flat_point.h"
+#include "point_cloud.h"
 #include "charmap.h"
+#include "input_view.h"
+#include "report.h"
+#include "batch.h"
 
 using namespace std;
 
-using map_t = unordered_set<point_t>;
+using map_t = flat_point_set_t;
+// the same lit pixels as coordinate arrays, for their bounds
+using cloud_t = point_cloud_t<point2_t>;
 
 using data_t = pair<string, map_t>;
 using result_t = string;
 
 const data_t read_data(const string &filename);
-template <typename T> void print_result(T result, chrono::duration<double, milli> duration);
 
 // vector<point_t> keys(const map_t &map) {
 // 	vector<point_t> ks;
@@ -36,18 +41,15 @@ template <typename T> void print_result(T result, chrono::duration<double, milli
 // 	return ks;
 // }
 
-pair<point_t, point_t> bounds_of(const map_t &points) {
-	point_t bounds_min{*points.begin()};
-	point_t bounds_max{*points.begin()};
-
-	for (const auto &p : points) {
-		bounds_min.x = std::min(bounds_min.x, p.x);
-		bounds_max.x = std::max(bounds_max.x, p.x);
-
-		bounds_min.y = std::min(bounds_min.y, p.y);
-		bounds_max.y = std::max(bounds_max.y, p.y);
+// min and max over the lit pixels' x and y arrays, an empty image is a
+// box of nothing at the origin
+pair<point_t, point_t> bounds_of(const cloud_t &lit) {
+	if (lit.empty()) {
+		return {};
 	}
-	return {bounds_min, bounds_max};
+
+	const auto [lo, hi] = lit.bounds();
+	return {{lo.x, lo.y}, {hi.x, hi.y}};
 }
 
 pair<point_t, point_t> outset_box(pair<point_t, point_t> bounds, dimension_t n) {
@@ -103,11 +105,18 @@ const result_t part1(const data_t &data) {
 	map_t current = points;
 	map_t next;
 
+	cloud_t current_lit;
+	cloud_t next_lit;
+	current_lit.reserve(points.size());
+	for (const point_key_t &key : points) {
+		current_lit.push_back(key.to_point<point2_t>());
+	}
+
 	int iterations = 0;
 	while (iterations < 50) {
 		char check_char = (iterations % 2) ? '#' : '.';
 
-		auto [bound_min, bound_max] = outset_box(bounds_of(current), 4);
+		auto [bound_min, bound_max] = outset_box(bounds_of(current_lit), 4);
 		// println("{}, {} 0 is {}", bound_min, bound_max, check_char);
 
 		for (dimension_t y = bound_min.y; y < bound_max.y; y++) {
@@ -122,12 +131,15 @@ const result_t part1(const data_t &data) {
 				// println("{} -> {} = {}", p, pixel_index, value);
 				if (rule == check_char) {
 					next.emplace(p);
+					next_lit.push_back({x, y});
 				}
 			}
 		}
 
 		swap(next, current);
+		swap(next_lit, current_lit);
 		next.clear();
+		next_lit.clear();
 		iterations++;
 	}
 
@@ -146,15 +158,14 @@ const result_t part2([[maybe_unused]] const data_t &data) {
 }
 
 const data_t read_data(const string &filename) {
-	std::ifstream ifs(filename);
+	input_view_t input(filename);
 
-	string instructions;
-	getline(ifs, instructions);
-	
-	string ignore;
-	getline(ifs, ignore);
+	// the enhancement instructions, a blank line, then the image
+	const string_view text = input.text();
+	const size_t image = text.find("\n\n");
+	const string instructions{text.substr(0, image)};
 
-	charmap_t map = charmap_t::from_stream(ifs);
+	charmap_t map(image == string_view::npos ? string_view{} : text.substr(image + 2));
 	map_t points;
 	for (const auto &p : map.all_points()) {
 		if (p.w == '#') {
@@ -165,43 +176,15 @@ const data_t read_data(const string &filename) {
 	return {instructions, points};
 }
 
-template <typename T>
-void print_result(T result, chrono::duration<double, milli> duration) {
-	const int time_width = 10;
-	const int time_precision = 4;
-	const int result_width = 15;
-
-	cout << std::setw(result_width) << std::right << result;
-
-	cout << " ("
-		 << std::setw(time_width) << std::fixed << std::right 
-		 << std::setprecision(time_precision)
-		 << duration.count() << "ms)";
-	cout << endl;
-}
-
+#if !defined(AOC_SOLVER)
 int main(int argc, char *argv[]) {
-	const char *input_file = argv[1];
-	if (argc < 2) {
-		input_file = "test.txt";
-	}
-
-    auto start_time = chrono::high_resolution_clock::now();
-
-	auto data = read_data(input_file);
-
-	auto parse_time = chrono::high_resolution_clock::now();
-	print_result("parse", (parse_time - start_time));
-
-	result_t p1_result = part1(data);
-
-	auto p1_time = chrono::high_resolution_clock::now();
-	print_result(p1_result, (p1_time - parse_time));
-
-	result_t p2_result = part2(data);
-
-	auto p2_time = chrono::high_resolution_clock::now();
-	print_result(p2_result, (p2_time - p1_time));
+	return day_main<read_data, part1, part2>(argc, argv);
+}
+#else
+#include "aoc_solver.h"
 
-	print_result("total", (p2_time - start_time));
+// entry point for libaoc, see aoc_solver.h
+AOC_EXPORT const aoc_solver_t *aoc_solver() {
+	return make_solver<read_data, part1, part2>(AOC_DAY);
 }
+#endif
@@ -15,7 +15,10 @@
 
 #include "point.h"
 #include "cube.h"
-#include "split.h"
+#include "scan.h"
+#include "input_view.h"
+#include "report.h"
+#include "batch.h"
 
 using namespace std;
 
@@ -28,7 +31,6 @@ using data_t = vector<instruction_t>;
 using result_t = uint64_t;
 
 const data_t read_data(const string &filename);
-template <typename T> void print_result(T result, chrono::duration<double, milli> duration);
 
 result_t volume(const vector<cube_t> &cubes) {
 	// playing with c++ algorithms
@@ -114,25 +116,24 @@ result_t part2([[maybe_unused]] const data_t &data) {
 const data_t read_data(const string &filename) {
 	data_t data;
 
-	std::ifstream ifs(filename);
-
-	std::string line;
-	while (std::getline(ifs, line)) {
-		auto parts = split_str(line, " ,.=..");
-		if (parts.size() == 10) {
-			long x_min = atoi(parts[2].c_str());
-			long x_max = atoi(parts[3].c_str());
-			long y_min = atoi(parts[5].c_str());
-			long y_max = atoi(parts[6].c_str());
-			long z_min = atoi(parts[8].c_str());
-			long z_max = atoi(parts[9].c_str());
+	input_view_t input(filename);
+	for (const auto line : input.lines()) {
+		// "on x=-20..26,y=-36..17,z=-47..7"
+		auto nums = scan_numbers<long>(line);
+		if (nums.size() == 6) {
+			long x_min = nums[0];
+			long x_max = nums[1];
+			long y_min = nums[2];
+			long y_max = nums[3];
+			long z_min = nums[4];
+			long z_max = nums[5];
 
 			assert(x_min <= x_max);
 			assert(y_min <= y_max);
 			assert(z_min <= z_max);
 
 			instruction_t instr;
-			instr.turn_on = (parts[0] == "on");
+			instr.turn_on = line.starts_with("on");
 			instr.cube = cube_t(x_min, y_min, z_min, x_max, y_max, z_max);
 			data.push_back(instr);
 		}
@@ -141,43 +142,15 @@ const data_t read_data(const string &filename) {
 	return data;
 }
 
-template <typename T>
-void print_result(T result, chrono::duration<double, milli> duration) {
-	const int time_width = 10;
-	const int time_precision = 4;
-	const int result_width = 15;
-
-	cout << std::setw(result_width) << std::right << result;
-
-	cout << " ("
-		 << std::setw(time_width) << std::fixed << std::right 
-		 << std::setprecision(time_precision)
-		 << duration.count() << "ms)";
-	cout << endl;
-}
-
+#if !defined(AOC_SOLVER)
 int main(int argc, char *argv[]) {
-	const char *input_file = argv[1];
-	if (argc < 2) {
-		input_file = "test.txt";
-	}
-
-    auto start_time = chrono::high_resolution_clock::now();
-
-	auto data = read_data(input_file);
-
-	auto parse_time = chrono::high_resolution_clock::now();
-	print_result("parse", (parse_time - start_time));
-
-	result_t p1_result = part1(data);
-
-	auto p1_time = chrono::high_resolution_clock::now();
-	print_result(p1_result, (p1_time - parse_time));
-
-	result_t p2_result = part2(data);
-
-	auto p2_time = chrono::high_resolution_clock::now();
-	print_result(p2_result, (p2_time - p1_time));
+	return day_main<read_data, part1, part2>(argc, argv);
+}
+#else
+#include "aoc_solver.h"
 
-	print_result("total", (p2_time - start_time));
+// entry point for libaoc, see aoc_solver.h
+AOC_EXPORT const aoc_solver_t *aoc_solver() {
+	return make_solver<read_data, part1, part2>(AOC_DAY);
 }
+#endif
@@ -1,4 +1,3 @@
-#include <unistd.h>     // getopt
 #include <chrono>       // high resolution timer
 #include <cstring>      // strtok, strdup
 #include <fstream>      // ifstream (reading file)
@@ -11,11 +10,14 @@
 #include <ranges>		// ranges and views
 #include <algorithm>	// sort
 #include <numeric>		// max, reduce, etc.
-#include <map>			// map
-#include <queue>		// priority_queue
-#include <unordered_set> // unordered_set
+#include <array>		// array
+#include <bit>			// popcount
 
-#include "charmap.h"
+#include "search.h"
+#include "probe.h"
+#include "input_view.h"
+#include "report.h"
+#include "batch.h"
 
 using namespace std;
 
@@ -23,513 +25,571 @@ using namespace std;
 /* final result is a very long unsigned int */
 using result_t = uint64_t;
 
-/* 
- * state of the system, including cost to reach this state
- * represented as a string which can be hashed easily.
+/* The burrow packed 3 bits a cell, cell i in bits 3i..3i+2; 0 is empty,
+ * then the amphipods A on as in cell_chars. Where each cell is on the
+ * board is up to board_t. 42 cells fit in an unsigned __int128 (GCC and
+ * clang), so a whole burrow compares and hashes as one number. Nothing is
+ * ever all empty, 0 is not a burrow.
  */
-struct state_t {
-	std::string state;
-	size_t cost;
+__extension__ typedef unsigned __int128 burrow_t;
 
-	// needed for hasing and equality comparison
-	bool operator==(const state_t &other) const {
-		return state == other.state;
-	}
-};
+const size_t max_cells = 128 / 3;
+const unsigned cell_empty = 0;
+const string cell_chars = ".ABCDEFG";
 
-/* hash function so can be put in unordered_map or set */
-template <>
-struct std::hash<state_t> {
-	size_t operator()(const state_t &sc) const {
-		return std::hash<std::string>()(sc.state);
-	}
-};
+inline unsigned get_cell(burrow_t burrow, size_t pos) {
+	return static_cast<unsigned>(burrow >> (3 * pos)) & 7;
+}
 
-/* cost comparison function for priority queue containing state_t */
-class compare_cost {
-	public:
-		bool operator()(state_t &a, state_t &b) {
-			return b.cost < a.cost;
-		}
-};
+inline burrow_t set_cell(burrow_t burrow, size_t pos, unsigned cell) {
+	burrow &= ~(burrow_t{7} << (3 * pos));
+	return burrow | (burrow_t{cell} << (3 * pos));
+}
 
+// the lowest bit of cell pos, masks of cells are made of these
+inline burrow_t cell_bit(size_t pos) {
+	return burrow_t{1} << (3 * pos);
+}
 
-const state_t read_data(const string &filename);
-template <typename T> void print_result(T result, chrono::duration<double, milli> duration);
+constexpr burrow_t every_cell_bit() {
+	burrow_t bits = 0;
+	for (size_t i = 0; i < max_cells; i++) {
+		bits |= burrow_t{1} << (3 * i);
+	}
 
-void show_state_compact(const state_t &state) {
-	cout << state.state << "  \t" << state.cost << endl;
+	return bits;
 }
 
-void show_state(const state_t &state) {
-	string board = "#############\n#...........#\n###.#.#.#.###\n  #.#.#.#.#\n  #.#.#.#.#\n  #.#.#.#.#\n  #########";
-
-	board[15] = state.state[0];
-	board[16] = state.state[1];
-	board[17] = state.state[2];
-	board[18] = state.state[3];
-	board[19] = state.state[4];
-	board[20] = state.state[5];
-	board[21] = state.state[6];
-	board[22] = state.state[7];
-	board[23] = state.state[8];
-	board[24] = state.state[9];
-	board[25] = state.state[10];
-
-	/* rooms */
-	board[31] = state.state[11];
-	board[33] = state.state[12];
-	board[35] = state.state[13];
-	board[37] = state.state[14];
-
-	board[45] = state.state[15];
-	board[47] = state.state[16];
-	board[49] = state.state[17];
-	board[51] = state.state[18];
-
-	/* part 2, bigger rooms */
-	board[57] = state.state[19];
-	board[59] = state.state[20];
-	board[61] = state.state[21];
-	board[63] = state.state[22];
-	board[69] = state.state[23];
-	board[71] = state.state[24];
-	board[73] = state.state[25];
-	board[75] = state.state[26];
-
-	cout << board << "  \t" << state.cost << endl;
+// the cell bit of every cell that is not empty
+inline burrow_t occupied(burrow_t burrow) {
+	return (burrow | burrow >> 1 | burrow >> 2) & every_cell_bit();
 }
 
-// Valid moves from each position, represented as a map/graph
-// of position index to vector of move_t structs which include
-// position index, cost to move there, and restriction (which amphipod can go there
-struct move_t {
-	size_t position;	// position index
-	size_t cost;		// cost to move here
-};
+// how many cells in a mask
+inline size_t count_cells(burrow_t bits) {
+	return static_cast<size_t>(std::popcount(static_cast<uint64_t>(bits)) +
+							   std::popcount(static_cast<uint64_t>(bits >> 64)));
+}
 
+inline size_t burrow_hash(burrow_t burrow) {
+	uint64_t k = static_cast<uint64_t>(burrow) ^ (static_cast<uint64_t>(burrow >> 64) * 0x9e3779b97f4a7c15ULL);
+	k = (k ^ (k >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	k = (k ^ (k >> 27)) * 0x94d049bb133111ebULL;
+	return static_cast<size_t>(k ^ (k >> 31));
+}
 
-const std::map<char, std::vector<size_t>> amphipod_homes = {
-	{'A', {11, 15, 19, 23}},
-	{'B', {12, 16, 20, 24}},
-	{'C', {13, 17, 21, 25}},
-	{'D', {14, 18, 22, 26}},
-};
+/* burrow -> best cost found, for the search. Open addressing with linear
+ * probing, kept at most half full; a burrow of 0 is an empty slot. Has
+ * just the find(), end() and operator[] search.h uses, no erase.
+ */
+struct burrow_dist_t {
+	using entry_t = std::pair<burrow_t, size_t>;
+
+	std::vector<entry_t> slots = std::vector<entry_t>(min_slots);
+	size_t used = 0;
 
-size_t amphipod_entry(char amphipod) {
-	switch (amphipod) {
-		case 'A': return 2;
-		case 'B': return 4;
-		case 'C': return 6;
-		case 'D': return 8;
-		default: return 0;
+	entry_t *end() {
+		return nullptr;
 	}
-}
 
-size_t amphipod_cost(char amphipod) {
-	switch (amphipod) {
-		case 'A': return 1;
-		case 'B': return 10;
-		case 'C': return 100;
-		case 'D': return 1000;
-		default: return 0;
+	entry_t *find(burrow_t burrow) {
+		entry_t &slot = slots[probe(burrow)];
+		return slot.first ? &slot : end();
 	}
-}
 
-/* Find all the amphipods in the game */
-vector<size_t> find_amphipods(const state_t &state) {
-	vector<size_t> positions;
+	// cost for burrow, inserting 0 if it is not there
+	size_t &operator[](burrow_t burrow) {
+		if ((used + 1) * 2 > slots.size()) {
+			rehash();
+		}
 
-	for (size_t i = 0; i < state.state.size(); i++) {
-		char c = state.state[i];
-		if (c == 'A' || c == 'B' || c == 'C' || c == 'D') {
-			positions.push_back(i);
+		entry_t &slot = slots[probe(burrow)];
+		if (!slot.first) {
+			slot = {burrow, 0};
+			used++;
 		}
+
+		return slot.second;
 	}
 
-	return positions;
-}
+private:
+	static constexpr size_t min_slots = 1 << 12;
 
-/* is the position occupied in the state */
-bool is_occupied(const state_t &state, size_t pos) {
-	return state.state[pos] != '.';
-}
+	// slot holding burrow, or the empty slot where it would go
+	size_t probe(burrow_t burrow) const {
+		const size_t mask = slots.size() - 1;
+		size_t i = burrow_hash(burrow) & mask;
+		while (slots[i].first && slots[i].first != burrow) {
+			i = (i + 1) & mask;
+		}
 
-/* is the position a room */
-bool is_room(size_t pos) {
-	return pos >= 11;
-}
+		return i;
+	}
 
-/* is the amphipod at pos in its home room? */
-bool is_home_room(size_t pos, char amphipod) {
-	if (is_room(pos)) {
-		assert(amphipod_homes.contains(amphipod));
+	void rehash() {
+		std::vector<entry_t> old(slots.size() * 2);
+		swap(old, slots);
+		for (const auto &entry : old) {
+			if (entry.first) {
+				slots[probe(entry.first)] = entry;
+			}
+		}
+	}
+};
 
-		auto rooms = amphipod_homes.at(amphipod);
-		return std::find(rooms.begin(), rooms.end(), pos) != rooms.end();
+/* what it costs amphipod A, B, C... to take a step */
+const std::array<size_t, 8> amphipod_cost = {0, 1, 10, 100, 1000, 10000, 100000, 1000000};
+
+/* The shape of a burrow and the tables for moving about it, worked out
+ * once for each search. The hallway is cells 0 to hallway-1 and room r
+ * opens off hallway cell 2r+2, where nobody stops. The rooms come after
+ * the hallway a row at a time from the top, row 0 of room r is cell
+ * hallway+r. Amphipod a (1 for A) lives in room a-1.
+ *
+ * Every move goes between a hallway cell and a room cell; the steps it
+ * takes and the cells it passes through (neither end) are looked up, so
+ * a move is legal when none of those cells are occupied().
+ */
+struct board_t {
+	size_t hallway = 0;
+	size_t rooms = 0;
+	size_t depth = 0;
+	size_t cells = 0;
+
+	std::vector<size_t> stops{};		// hallway cells to stop in
+	std::vector<size_t> steps{};		// [hallway cell][room cell]
+	std::vector<burrow_t> passes{};		// [hallway cell][room cell]
+	std::vector<burrow_t> room_bits{};	// [room] its cells
+	std::vector<burrow_t> home_fill{};	// [amphipod] its room full of them
+	burrow_t final_burrow = 0;			// everyone home
+
+	board_t(size_t hallway, size_t rooms, size_t depth) :
+		hallway(hallway), rooms(rooms), depth(depth), cells(hallway + rooms * depth) {
+		assert(rooms >= 1 && rooms < cell_chars.size());
+		assert(hallway > entry(rooms - 1));
+		assert(cells <= max_cells);
+
+		for (size_t hall = 0; hall < hallway; hall++) {
+			if (hall < 2 || hall > entry(rooms - 1) || hall % 2) {
+				stops.push_back(hall);
+			}
+		}
+
+		steps.resize(hallway * rooms * depth);
+		passes.resize(hallway * rooms * depth);
+		room_bits.resize(rooms);
+		home_fill.resize(rooms + 1);
+
+		for (size_t room = 0; room < rooms; room++) {
+			const unsigned amphipod = static_cast<unsigned>(room + 1);
+
+			for (size_t row = 0; row < depth; row++) {
+				const size_t pos = room_cell(room, row);
+				room_bits[room] |= cell_bit(pos);
+				home_fill[amphipod] = set_cell(home_fill[amphipod], pos, amphipod);
+				final_burrow = set_cell(final_burrow, pos, amphipod);
+
+				// along the hallway to the room, then down it
+				for (size_t hall = 0; hall < hallway; hall++) {
+					const size_t left = min(hall, entry(room));
+					const size_t right = max(hall, entry(room));
+
+					burrow_t bits = 0;
+					for (size_t h = left; h <= right; h++) {
+						bits |= cell_bit(h);
+					}
+					for (size_t r = 0; r < row; r++) {
+						bits |= cell_bit(room_cell(room, r));
+					}
+
+					steps[index(hall, pos)] = right - left + row + 1;
+					passes[index(hall, pos)] = bits & ~cell_bit(hall);
+				}
+			}
+		}
 	}
 
-	return false;
-}
+	// the hallway cell outside room
+	size_t entry(size_t room) const {
+		return 2 * room + 2;
+	}
 
-/* does the amphipod's room contain only '.' or the amphipods that belong there? */
-bool room_contains_only(const state_t &state, char amphipod) {
-	assert(amphipod_homes.contains(amphipod));
+	bool is_room(size_t pos) const {
+		return pos >= hallway;
+	}
 
-	auto rooms = amphipod_homes.at(amphipod);
-	return std::all_of(rooms.begin(), rooms.end(), [&](size_t pos) {
-		return !is_occupied(state, pos) || state.state[pos] == amphipod || state.state[pos] == '~';
-	});
-}
-/* compute the distance between two positions */
-size_t distance(size_t from, size_t to) {
-	// make sure from is less than to
-	if (from > to) {
-		swap(from, to);
+	size_t room_cell(size_t room, size_t row) const {
+		return hallway + row * rooms + room;
 	}
 
-	assert(from <= 10);	// in the hallway
-	assert(to >= 11);	// in a room
+	size_t room_of(size_t pos) const {
+		return (pos - hallway) % rooms;
+	}
 
-	size_t dist = 0;
-	while (to >= 11) {
-		to -= 4;
-		dist++;
+	size_t row_of(size_t pos) const {
+		return (pos - hallway) / rooms;
 	}
 
-	switch(to) {
-		case 7: to = 2;	break;
-		case 8: to = 4;	break;
-		case 9: to = 6;	break;
-		case 10: to = 8; break;
+	size_t move_steps(size_t hall, size_t pos) const {
+		return steps[index(hall, pos)];
 	}
 
-	if (from > to) {
-		swap(from, to);
+	burrow_t move_passes(size_t hall, size_t pos) const {
+		return passes[index(hall, pos)];
 	}
-	dist += (to - from);
-	return dist;
-}
 
-/* return all valid moves to move out of a home */
-// 11 -> 1, 0
-// 11-> 3, 5, 7, 9, 10
-// 15 -> 11, 1, 0
-// 15 -> 11, 3, 5, 7, 9, 10
-std::map<size_t, std::pair<std::vector<size_t>, std::vector<size_t>>> out_moves = {
-	{11, {{1, 0}, {3, 5, 7, 9, 10}}},  // from 11 can move left, right
-	{12, {{3, 1, 0}, {5, 7, 9, 10}}},
-	{13, {{5, 3, 1, 0}, {7, 9, 10}}},
-	{14, {{7, 5, 3, 1, 0}, {9, 10}}},
-
-	{15, {{11, 1, 0}, {11, 3, 5, 7, 9, 10}}},
-	{16, {{12, 3, 1, 0}, {12, 5, 7, 9, 10}}},
-	{17, {{13, 5, 3, 1, 0}, {13, 7, 9, 10}}},
-	{18, {{14, 7, 5, 3, 1, 0}, {14, 9, 10}}},
-
-	{19, {{15, 11, 1, 0}, {15, 11, 3, 5, 7, 9, 10}}},
-	{20, {{16, 12, 3, 1, 0}, {16, 12, 5, 7, 9, 10}}},
-	{21, {{17, 13, 5, 3, 1, 0}, {17, 13, 7, 9, 10}}},
-	{22, {{18, 14, 7, 5, 3, 1, 0}, {18, 14, 9, 10}}},
-
-	{23, {{19, 15, 11, 1, 0}, {19, 15, 11, 3, 5, 7, 9, 10}}},
-	{24, {{20, 16, 12, 3, 1, 0}, {20, 16, 12, 5, 7, 9, 10}}},
-	{25, {{21, 17, 13, 5, 3, 1, 0}, {21, 17, 13, 7, 9, 10}}},
-	{26, {{22, 18, 14, 7, 5, 3, 1, 0}, {22, 18, 14, 9, 10}}},
+private:
+	size_t index(size_t hall, size_t pos) const {
+		return hall * rooms * depth + (pos - hallway);
+	}
 };
-std::vector<move_t> move_out(const state_t &state, size_t pos) {
-	std::vector<move_t> moves;
-	assert(is_room(pos));
-
-	// go left and look
-	for (auto left_pos : out_moves.at(pos).first) {
-		if (is_occupied(state, left_pos)) {
-			break;
-		}
 
-		if (!is_room(left_pos)) {
-			moves.push_back({left_pos, distance(pos, left_pos)});
-		}
-	}
+/* 
+ * state of the system, including cost to reach this state, or a move to
+ * it and the cost of that
+ */
+struct state_t {
+	burrow_t state;
+	size_t cost;
+};
 
-	// go right young man
-	for (auto right_pos : out_moves.at(pos).second) {
-		if (is_occupied(state, right_pos)) {
-			break;
-		}
+/* the burrow as read, the hallway and the rows of the rooms top down */
+struct burrow_input_t {
+	string hallway{};
+	vector<string> rows{};
+};
 
-		if (!is_room(right_pos)) {
-			moves.push_back({right_pos, distance(pos, right_pos)});
-		}
-	}
+const burrow_input_t read_data(const string &filename);
 
-	return moves;
+// the cell for c from the input, empty or one of the board's amphipods
+unsigned cell_of(const board_t &board, char c) {
+	const size_t cell = cell_chars.find(c);
+	assert(cell != string::npos && cell <= board.rooms);
+	return static_cast<unsigned>(cell);
 }
 
-/* return all valid moves to move into a home */
-std::vector<move_t> move_in(const state_t &state, size_t pos) {
-	std::vector<move_t> moves;
-
-	assert(!is_room(pos));
+burrow_t pack_burrow(const board_t &board, const burrow_input_t &input) {
+	burrow_t burrow = 0;
 
-	// does my room contain only my amphipods?
-	char amphipod = state.state[pos];
-	if (!room_contains_only(state, amphipod)) {
-		return moves;
+	for (size_t hall = 0; hall < board.hallway; hall++) {
+		burrow = set_cell(burrow, hall, cell_of(board, input.hallway[hall]));
 	}
 
-	// can I get to my home entry?
-	size_t entry = amphipod_entry(amphipod);
-	if (pos < entry) {
-		for (size_t p = pos + 1; p <= entry; p++) {
-			if (is_occupied(state, p)) {
-				return moves;
-			}
-		}
-	} else if (pos > entry) {
-		for (size_t p = entry; p < pos; p++) {
-			if (is_occupied(state, p)) {
-				return moves;
-			}
+	for (size_t row = 0; row < board.depth; row++) {
+		assert(input.rows[row].size() == board.rooms);
+		for (size_t room = 0; room < board.rooms; room++) {
+			burrow = set_cell(burrow, board.room_cell(room, row), cell_of(board, input.rows[row][room]));
 		}
 	}
 
-	auto home_rooms = amphipod_homes.at(amphipod);
-	// find deepest available home room
-	size_t last_pos = 0;
-	for (auto room : home_rooms) {
-		if (!is_occupied(state, room)) {
-			last_pos = room;
-		}
-	}
+	return burrow;
+}
 
-	if (last_pos != 0) {
-		moves.push_back({last_pos, distance(pos, last_pos)});
+string unpack_burrow(const board_t &board, burrow_t burrow) {
+	string cells;
+	for (size_t i = 0; i < board.cells; i++) {
+		cells.push_back(cell_chars[get_cell(burrow, i)]);
 	}
 
-	return moves;
+	return cells;
 }
 
-/* return all the valid moves for the amphipod at pos.
- * avoid backracking to 'from' position.
- */
-std::vector<move_t> valid_moves(const state_t &state, size_t pos) {
-	if (is_room(pos)) {
-		return move_out(state, pos);
-	}
-
-	return move_in(state, pos);
+void show_state_compact(const board_t &board, const state_t &state) {
+	cout << unpack_burrow(board, state.state) << "  \t" << state.cost << endl;
 }
 
-/* Returns all the possible next states for the amphipod at pos */
-void next_states(const state_t &state, size_t pos, [[maybe_unused]] size_t from, unordered_set<state_t> &states) {
-	char amphipod = state.state[pos];
-
-	for (const auto &move : valid_moves(state, pos)) {
-		// create next state from valid move
-		state_t new_state = state;
-		swap(new_state.state[pos], new_state.state[move.position]);
-		new_state.cost += amphipod_cost(amphipod) * move.cost;
-
-		// if this state is new or lower cost than an existing version, add it to the set
-		if (!states.contains(new_state) || states.find(new_state)->cost > new_state.cost) {
-			// remove existing higher cost state
-			auto existing = states.find(new_state);
-			if (existing != states.end()) {
-				states.erase(existing);
-			}
+void show_state(const board_t &board, const state_t &state) {
+	const string cells = unpack_burrow(board, state.state);
+	string picture = string(board.hallway + 2, '#') + "\n#" + cells.substr(0, board.hallway) + "#\n";
 
-			states.insert(new_state);
-			// recursive moves, don't backtrack to where we came from
-			next_states(new_state, move.position, pos, states);
+	for (size_t row = 0; row < board.depth; row++) {
+		string line = row ? "  " : "##";
+		for (size_t room = 0; room < board.rooms; room++) {
+			line.push_back('#');
+			line.push_back(cells[board.room_cell(room, row)]);
 		}
-	}
-}
+		line.push_back('#');
 
-/* Returns all the possible next states from the current state 
- * includes seeing if any amphipod can move.
- */
-unordered_set<state_t> next_states(const state_t &state) {
-	unordered_set<state_t> states;
-
-	bool debug = false;
-	if (debug) {
-		// run a single state expansion for testing
-		// show_state_compact(state);
-		next_states(state, 13, 13, states);
-		show_state_compact(state);
-	} else {
-		for (auto pos : find_amphipods(state)) {
-			next_states(state, pos, pos, states);
+		if (row == 0) {
+			line.resize(board.hallway + 2, '#');
 		}
+		picture += line + "\n";
 	}
+	picture += "  " + string(2 * board.rooms + 1, '#');
 
-	return states;
+	cout << picture << "  \t" << state.cost << endl;
 }
 
-/* Dijkstra's algorithm for finding the shortest path in a weighted graph.
- * In our case the graph is all possible states and the weights are the costs
- * to move between states.
- */
-result_t dijkstra(const state_t &initial_state, const state_t &final_state) {
-	bool debug = false;
+/* is the amphipod at pos in its home room? */
+bool is_home_room(const board_t &board, size_t pos, unsigned amphipod) {
+	return board.is_room(pos) && board.room_of(pos) == amphipod - 1;
+}
 
-	std::priority_queue<state_t, std::vector<state_t>, compare_cost> Q;
-	std::map<string, size_t> dist;
+/* does the amphipod's room contain only empty cells or the amphipods that belong there? */
+bool room_contains_only(const board_t &board, burrow_t burrow, unsigned amphipod) {
+	assert(amphipod >= 1 && amphipod <= board.rooms);
 
-	Q.push(initial_state);
-	dist[initial_state.state] = 0;
+	// cells of the room that are not this amphipod, and not empty
+	const burrow_t room = burrow & (board.room_bits[amphipod - 1] * 7);
+	return (occupied(room ^ board.home_fill[amphipod]) & occupied(room)) == 0;
+}
+
+/* add the moves out of the room from pos, to anywhere in the hallway with
+ * nobody in the way */
+void move_out(const board_t &board, burrow_t burrow, size_t pos, std::vector<state_t> &moves) {
+	assert(board.is_room(pos));
 
-	size_t iterations = 0;
+	const unsigned amphipod = get_cell(burrow, pos);
+	const burrow_t occupied_bits = occupied(burrow);
+	const burrow_t moved = set_cell(burrow, pos, cell_empty);
 
-	while (!Q.empty()) {
-		if (debug && ++iterations % 10000 == 0) {
-			cout << "\33[2K\r" << iterations << " iterations, " << Q.size() << " states in queue, " << dist.size() << " total states.";
-			cout << std::flush;
+	for (auto hall : board.stops) {
+		if (!(occupied_bits & (board.move_passes(hall, pos) | cell_bit(hall)))) {
+			moves.push_back({set_cell(moved, hall, amphipod), amphipod_cost[amphipod] * board.move_steps(hall, pos)});
 		}
+	}
+}
 
-		state_t u = Q.top();
-		Q.pop();
+/* add the move home from pos in the hallway, if there is one; only ever to
+ * the deepest empty cell */
+void move_in(const board_t &board, burrow_t burrow, size_t pos, std::vector<state_t> &moves) {
+	assert(!board.is_room(pos));
 
-		auto states = next_states(u);
-		for (const auto &state : states) {
-			if (!dist.contains(state.state) || dist[state.state] > state.cost) {
-				Q.push(state);
-				dist[state.state] = state.cost;
-			}
-		}
+	// does my room contain only my amphipods?
+	const unsigned amphipod = get_cell(burrow, pos);
+	if (!room_contains_only(board, burrow, amphipod)) {
+		return;
 	}
 
-	if (debug) {
-		cout << "\33[2K\rDijkstra complete after " << iterations << " iterations, " << dist.size() << " total states." << endl;
-		for (auto [state, cost] : dist) {
-			if (state == final_state.state) {
-				cout << endl;
-				cout << state << "\t" << cost;
-				cout << " Final state!";
-				cout << endl;
-			}
-		}
+	// it fills from the bottom, so the empty cells are the top ones
+	const size_t room = amphipod - 1;
+	const burrow_t occupied_bits = occupied(burrow);
+	const size_t empty = count_cells(board.room_bits[room] & ~occupied_bits);
+	if (empty == 0) {
+		return;
 	}
 
-	// return the distance to the final state
-	return dist[final_state.state];
+	// can I get there?
+	const size_t last_pos = board.room_cell(room, empty - 1);
+	if (!(occupied_bits & board.move_passes(pos, last_pos))) {
+		const burrow_t moved = set_cell(burrow, pos, cell_empty);
+		moves.push_back({set_cell(moved, last_pos, amphipod), amphipod_cost[amphipod] * board.move_steps(pos, last_pos)});
+	}
 }
 
+/* All the states one move on from burrow, with the cost of each move, into
+ * moves. That is cleared first and keeps its memory from call to call.
+ *
+ * An amphipod in the hallway can only go home. In a room only the top
+ * one can move, out into the hallway, and not at all when the room has
+ * only its own kind in it. Going from one room to another passes a stop
+ * in the hallway between them, so is two moves for the same cost.
+ */
+void next_states(const board_t &board, burrow_t burrow, std::vector<state_t> &moves) {
+	moves.clear();
+
+	for (size_t hall = 0; hall < board.hallway; hall++) {
+		if (get_cell(burrow, hall) != cell_empty) {
+			move_in(board, burrow, hall, moves);
+		}
+	}
 
-/* Part 1 */
-result_t part1(const state_t &data) {
-	state_t final_state = {"...........ABCDABCD~~~~~~~~", 0};
-	state_t initial_state = {data.state + "~~~~~~~~", 0};
+	for (size_t room = 0; room < board.rooms; room++) {
+		if (room_contains_only(board, burrow, static_cast<unsigned>(room + 1))) {
+			continue;
+		}
 
-	assert(distance(11, 0) == 3);
-	assert(distance(15, 0) == 4);
-	assert(distance(12, 10) == 7);
-	assert(distance(12, 3) == 2);
-	assert(distance(18, 10) == 4);
-	assert(distance(13, 1) == 6);
+		for (size_t row = 0; row < board.depth; row++) {
+			const size_t pos = board.room_cell(room, row);
+			if (get_cell(burrow, pos) != cell_empty) {
+				move_out(board, burrow, pos, moves);
+				break;
+			}
+		}
+	}
+}
 
-	assert(distance(0, 11) == 3);
-	assert(distance(1, 15) == 3);
-	assert(distance(10, 15) == 10);
-	assert(distance(5, 18) == 5);
+/* search with A* and cost_to_home() (the default), or Dijkstra, no
+ * heuristic, with -d. Set by command line. */
+static bool use_astar = true;
 
-	// show_state(initial_state);
-	// show_state_compact(initial_state);
+/* is the amphipod at pos in its home room with only its own kind below? */
+bool is_settled(const board_t &board, burrow_t burrow, size_t pos, unsigned amphipod) {
+	if (!is_home_room(board, pos, amphipod)) {
+		return false;
+	}
 
-	bool debug = false;
-	if (debug) {
-		cout << "Initial state:" << endl;
-		show_state_compact(initial_state);
-	
-		auto states = next_states(initial_state);
-		cout << "Found " << states.size() << " next states." << endl;
-		for (const auto &state : states) {
-			show_state_compact(state);
+	for (size_t below = pos + board.rooms; below < board.cells; below += board.rooms) {
+		if (get_cell(burrow, below) != amphipod) {
+			return false;
 		}
-		return 0;
 	}
 
-	return dijkstra(initial_state, final_state);
+	return true;
 }
 
-result_t part2([[maybe_unused]] const state_t &data) {
-	state_t final_state = {"...........ABCDABCDABCDABCD", 0};
+/* A lower bound on the cost left to the final state. Every amphipod not
+ * settled walks to the top of its room as if nothing were in the way; out
+ * of the room it is in and along the hallway, or if it is home but above
+ * a stranger, out one step to the side and back. Then the k of a kind
+ * going home have to fill the room from the bottom, at least
+ * 0 + 1 + ... + k-1 more steps down between them.
+ */
+size_t cost_to_home(const board_t &board, burrow_t burrow) {
+	size_t cost = 0;
+	std::array<size_t, 8> going_home{};
+
+	for (size_t pos = 0; pos < board.cells; pos++) {
+		unsigned amphipod = get_cell(burrow, pos);
+		if (amphipod == cell_empty || is_settled(board, burrow, pos, amphipod)) {
+			continue;
+		}
 
-	// unfold the extra lines for the initial state
-	string unfolded_state = data.state.substr(0, 15) + "DCBADBAC" + data.state.substr(15);
-	state_t initial_state = {unfolded_state, 0};
+		const size_t home = amphipod - 1;
+		size_t steps;
+		if (!board.is_room(pos)) {
+			steps = board.move_steps(pos, board.room_cell(home, 0));
+		} else if (board.room_of(pos) == home) {
+			steps = board.row_of(pos) + 4;
+		} else {
+			steps = board.move_steps(board.entry(home), pos) + 1;
+		}
 
-	bool debug = false;
-	if (debug) {
-		show_state(initial_state);
-		show_state_compact(initial_state);
+		cost += amphipod_cost[amphipod] * steps;
+		going_home[amphipod]++;
+	}
 
-		show_state(final_state);
-		show_state_compact(final_state);
+	for (unsigned amphipod = 1; amphipod <= board.rooms; amphipod++) {
+		size_t k = going_home[amphipod];
+		cost += amphipod_cost[amphipod] * (k ? k * (k - 1) / 2 : 0);
 	}
 
-	return dijkstra(initial_state, final_state);
+	return cost;
 }
 
-const state_t read_data(const string &filename) {
-	charmap_t map = charmap_t::from_file(filename);
+static probe_timer_t search_time("day23 search");
+static probe_counter_t states_expanded("day23 states expanded");
+static probe_counter_t states_generated("day23 states generated");
+static probe_counter_t queue_pushes("day23 queue pushes");
+static probe_counter_t queue_pops("day23 queue pops");
+static probe_counter_t queue_stale("day23 stale pops");
+
+/* Cheapest way to get everyone home from the burrow as read, a shortest
+ * path in the graph of all possible states where the weights are the
+ * costs to move between states. A* with cost_to_home(), or Dijkstra's
+ * algorithm when use_astar is off. Stops as soon as the final state comes
+ * off the queue, stale queue entries are skipped (see search_astar()).
+ */
+result_t search_burrow(const burrow_input_t &input) {
+	const board_t board(input.hallway.size(), input.rows.at(0).size(), input.rows.size());
+	const burrow_t initial_state = pack_burrow(board, input);
+
+	// search on the packed burrow, the moves out of each one go in the
+	// same buffer
+	std::vector<state_t> moves;
+	moves.reserve(board.hallway + board.rooms * board.stops.size());
+
+	auto neighbors = [&board, &moves](burrow_t burrow, auto &&emit) {
+		++states_expanded;
+		next_states(board, burrow, moves);
+		states_generated.add(moves.size());
+		for (const auto &move : moves) {
+			emit(move.state, move.cost);
+		}
+	};
 
-	string data; // = "...........";
-	for (size_t i = 1; i < 12; i++) {
-		data.push_back(map.get(i, 1));
-	}
-	data.push_back(map.get(3, 2));
-	data.push_back(map.get(5, 2));
-	data.push_back(map.get(7, 2));
-	data.push_back(map.get(9, 2));
+	auto is_final = [&board](burrow_t burrow) {
+		return burrow == board.final_burrow;
+	};
 
-	data.push_back(map.get(3, 3));
-	data.push_back(map.get(5, 3));
-	data.push_back(map.get(7, 3));
-	data.push_back(map.get(9, 3));
+	auto heuristic = [&board](burrow_t burrow) {
+		return cost_to_home(board, burrow);
+	};
 
-	state_t initial_state = {data, 0};
-	return initial_state;
-}
+	bool debug = false;
+	if (debug) {
+		show_state(board, {initial_state, 0});
+		show_state_compact(board, {initial_state, 0});
 
-template <typename T>
-void print_result(T result, chrono::duration<double, milli> duration) {
-	const int time_width = 10;
-	const int time_precision = 4;
-	const int result_width = 15;
+		next_states(board, initial_state, moves);
+		cout << "Found " << moves.size() << " next states." << endl;
+		for (const auto &move : moves) {
+			show_state_compact(board, move);
+		}
+	}
+
+	probe_scope_t scope(search_time);
+	burrow_dist_t dist;
+	search_stats_t stats;
+	result_t cost = use_astar
+		? search_astar(initial_state, neighbors, is_final, heuristic, dist, no_pred_t{}, &stats)
+		: search_dijkstra(initial_state, neighbors, is_final, dist, no_pred_t{}, &stats);
+
+	queue_pushes.add(stats.pushed);
+	queue_pops.add(stats.popped);
+	queue_stale.add(stats.stale);
+	return cost;
+}
 
-	cout << std::setw(result_width) << std::right << result;
 
-	cout << " ("
-		 << std::setw(time_width) << std::fixed << std::right 
-		 << std::setprecision(time_precision)
-		 << duration.count() << "ms)";
-	cout << endl;
+/* Part 1 */
+result_t part1(const burrow_input_t &data) {
+	return search_burrow(data);
 }
 
-int main(int argc, char *argv[]) {
-	const char *input_file = argv[1];
-	if (argc < 2) {
-		input_file = "test.txt";
+/* Part 2, the same with two more rows unfolded under the top one. They
+ * belong to the puzzle's four rooms two deep, any other burrow (aoc_gen
+ * makes deeper ones) is searched as read.
+ */
+result_t part2(const burrow_input_t &data) {
+	burrow_input_t unfolded = data;
+	if (unfolded.rows.size() == 2 && unfolded.rows[0].size() == 4) {
+		unfolded.rows.insert(unfolded.rows.begin() + 1, {"DCBA", "DBAC"});
 	}
 
-    auto start_time = chrono::high_resolution_clock::now();
+	return search_burrow(unfolded);
+}
 
-	auto data = read_data(input_file);
+/* The hallway is the first line with more than walls in it, the rooms are
+ * whatever is not a wall in the lines after. Any hallway length, number
+ * of rooms and depth, as long as it fits board_t.
+ */
+const burrow_input_t read_data(const string &filename) {
+	input_view_t burrow(filename);
+	burrow_input_t input;
 
-	auto parse_time = chrono::high_resolution_clock::now();
-	print_result("parse", (parse_time - start_time));
+	for (const auto line : burrow.lines()) {
+		if (line.find_first_not_of("# ") == string_view::npos) {
+			continue;
+		}
 
-	result_t p1_result = part1(data);
+		if (input.hallway.empty()) {
+			const size_t left = line.find('#');
+			input.hallway = line.substr(left + 1, line.rfind('#') - left - 1);
+			continue;
+		}
 
-	auto p1_time = chrono::high_resolution_clock::now();
-	print_result(p1_result, (p1_time - parse_time));
+		string row;
+		for (char c : line) {
+			if (c != '#' && c != ' ') {
+				row.push_back(c);
+			}
+		}
+		input.rows.push_back(row);
+	}
 
-	result_t p2_result = part2(data);
+	return input;
+}
 
-	auto p2_time = chrono::high_resolution_clock::now();
-	print_result(p2_result, (p2_time - p1_time));
+#if !defined(AOC_SOLVER)
+int main(int argc, char *argv[]) {
+	return day_main<read_data, part1, part2>(argc, argv, {{'d', [] { use_astar = false; }}});
+}
+#else
+#include "aoc_solver.h"
 
-	print_result("total", (p2_time - start_time));
+// entry point for libaoc, see aoc_solver.h
+AOC_EXPORT const aoc_solver_t *aoc_solver() {
+	return make_solver<read_data, part1, part2>(AOC_DAY);
 }
+#endif
@@ -13,6 +13,9 @@
 #include <unordered_set>
 
 #include "split.h"
+#include "input_view.h"
+#include "report.h"
+#include "batch.h"
 
 using namespace std;
 
@@ -22,7 +25,6 @@ using data_t = pair<vector<size_t>, vector<board_t>>;
 using result_t = string;
 
 const data_t read_data(const string &filename);
-template <typename T> void print_result(T result, chrono::duration<double, milli> duration);
 
 
 /* Remove number from all rows (and columns) on board.
@@ -130,17 +132,19 @@ const data_t read_data(const string &filename) {
 	vector<size_t> numbers;
 	vector<board_t> boards;
 
-	std::ifstream ifs(filename);
+	input_view_t input(filename);
+	auto lines = input.lines();
 
-	string line;
-	if (getline(ifs, line)) {
-		numbers = split_size_t(line);
+	auto line = lines.begin();
+	if (line != lines.end()) {
+		numbers = split_size_t(*line);
+		++line;
 	}
 
 	board_t board;
-	while (getline(ifs, line)) {
-		if (!line.empty()) {
-			vector<size_t> row = split_size_t(line);
+	for (; line != lines.end(); ++line) {
+		if (!(*line).empty()) {
+			vector<size_t> row = split_size_t(*line);
 			board.emplace_back(row);
 		} else if (board.size() > 0) {
 			add_cols(board); // add columns as rows
@@ -153,43 +157,15 @@ const data_t read_data(const string &filename) {
 	return {numbers, boards};
 }
 
-template <typename T>
-void print_result(T result, chrono::duration<double, milli> duration) {
-	const int time_width = 10;
-	const int time_precision = 4;
-	const int result_width = 15;
-
-	cout << std::setw(result_width) << std::right << result;
-
-	cout << " ("
-		 << std::setw(time_width) << std::fixed << std::right 
-		 << std::setprecision(time_precision)
-		 << duration.count() << "ms)";
-	cout << endl;
-}
-
+#if !defined(AOC_SOLVER)
 int main(int argc, char *argv[]) {
-	const char *input_file = argv[1];
-	if (argc < 2) {
-		input_file = "test.txt";
-	}
-
-    auto start_time = chrono::high_resolution_clock::now();
-
-	auto data = read_data(input_file);
-
-	auto parse_time = chrono::high_resolution_clock::now();
-	print_result("parse", (parse_time - start_time));
-
-	result_t p1_result = part1(data);
-
-	auto p1_time = chrono::high_resolution_clock::now();
-	print_result(p1_result, (p1_time - parse_time));
-
-	result_t p2_result = part2(data);
-
-	auto p2_time = chrono::high_resolution_clock::now();
-	print_result(p2_result, (p2_time - p1_time));
+	return day_main<read_data, part1, part2>(argc, argv);
+}
+#else
+#include "aoc_solver.h"
 
-	print_result("total", (p2_time - start_time));
+// entry point for libaoc, see aoc_solver.h
+AOC_EXPORT const aoc_solver_t *aoc_solver() {
+	return make_solver<read_data, part1, part2>(AOC_DAY);
 }
+#endif
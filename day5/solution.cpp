@@ -10,16 +10,19 @@
 #include <ranges>		// ranges and views
 #include <algorithm>	// sort
 #include <numeric>		// max, reduce, etc.
-#include <unordered_map>
 
 #include "point.h"
+#include "flat_point.h"
 #include "split.h"
+#include "input_view.h"
+#include "report.h"
+#include "batch.h"
 
 using namespace std;
 
 struct line_t {
-	point_t p1{0, 0};
-	point_t p2{0, 0};
+	point2_t p1{0, 0};
+	point2_t p2{0, 0};
 
 	line_t(const vector<size_t> &pts) {
 		if (pts.size() > 1) {
@@ -35,7 +38,6 @@ using data_t = vector<line_t>;
 using result_t = string;
 
 const data_t read_data(const string &filename);
-template <typename T> void print_result(T result, chrono::duration<double, milli> duration);
 
 /* Is the line strictly vertical */
 bool is_vertical(const line_t &line) {
@@ -48,8 +50,8 @@ bool is_horizontal(const line_t &line) {
 }
 
 /* Return a vector of all the points this line crosses, including endpoints. */
-vector<point_t> points_on(const line_t &line) {
-	vector<point_t> points;
+vector<point2_t> points_on(const line_t &line) {
+	vector<point2_t> points;
 
 	int dx = line.p1.x == line.p2.x ? 0 : line.p1.x < line.p2.x ? 1 : -1;
 	int dy = line.p1.y == line.p2.y ? 0 : line.p1.y < line.p2.y ? 1 : -1;
@@ -64,7 +66,7 @@ vector<point_t> points_on(const line_t &line) {
 
 /* Part 1 */
 const result_t part1(const data_t &data) {
-	unordered_map<point_t, size_t> points;
+	flat_point_map_t<size_t> points;
 
 	/* filter only horizontal or vertical lines */
 	auto lines = data | views::filter([](const auto &line) {
@@ -87,7 +89,7 @@ const result_t part1(const data_t &data) {
 }
 
 const result_t part2(const data_t &data) {
-	unordered_map<point_t, size_t> points;
+	flat_point_map_t<size_t> points;
 
 	/* Create a map of all points crossed, number of crosses as the value. */
 	for (const line_t &line : data) {
@@ -105,10 +107,8 @@ const result_t part2(const data_t &data) {
 const data_t read_data(const string &filename) {
 	data_t data;
 
-	std::ifstream ifs(filename);
-
-	string line;
-	while (getline(ifs, line)) {
+	input_view_t input(filename);
+	for (const auto line : input.lines()) {
 		if (!line.empty()) {
 			data.push_back({split_size_t(line)});
 		}
@@ -117,43 +117,15 @@ const data_t read_data(const string &filename) {
 	return data;
 }
 
-template <typename T>
-void print_result(T result, chrono::duration<double, milli> duration) {
-	const int time_width = 10;
-	const int time_precision = 4;
-	const int result_width = 15;
-
-	cout << std::setw(result_width) << std::right << result;
-
-	cout << " ("
-		 << std::setw(time_width) << std::fixed << std::right 
-		 << std::setprecision(time_precision)
-		 << duration.count() << "ms)";
-	cout << endl;
-}
-
+#if !defined(AOC_SOLVER)
 int main(int argc, char *argv[]) {
-	const char *input_file = argv[1];
-	if (argc < 2) {
-		input_file = "test.txt";
-	}
-
-    auto start_time = chrono::high_resolution_clock::now();
-
-	auto data = read_data(input_file);
-
-	auto parse_time = chrono::high_resolution_clock::now();
-	print_result("parse", (parse_time - start_time));
-
-	result_t p1_result = part1(data);
-
-	auto p1_time = chrono::high_resolution_clock::now();
-	print_result(p1_result, (p1_time - parse_time));
-
-	result_t p2_result = part2(data);
-
-	auto p2_time = chrono::high_resolution_clock::now();
-	print_result(p2_result, (p2_time - p1_time));
+	return day_main<read_data, part1, part2>(argc, argv);
+}
+#else
+#include "aoc_solver.h"
 
-	print_result("total", (p2_time - start_time));
+// entry point for libaoc, see aoc_solver.h
+AOC_EXPORT const aoc_solver_t *aoc_solver() {
+	return make_solver<read_data, part1, part2>(AOC_DAY);
 }
+#endif
@@ -16,6 +16,9 @@
 
 #include "point.h"
 #include "charmap.h"
+#include "input_view.h"
+#include "report.h"
+#include "batch.h"
 
 using namespace std;
 
@@ -23,14 +26,14 @@ using data_t = charmap_t;
 using result_t = string;
 
 const data_t read_data(const string &filename);
-template <typename T> void print_result(T result, chrono::duration<double, milli> duration);
 
 /* Return range of low points on the map */
 auto low_points(const data_t &map) {
 	// test if point and char is a low point on the map.
 	// true if all neighbors have larger value, false otherwise
+	// the '9' border never makes a point not low, no bounds checks needed
 	auto is_low = [&map](const point_t &point, char ch) {
-		auto neighbors = map.neighbors_of(point);
+		auto neighbors = map.neighbors4(point);
 		return all_of(neighbors.begin(), neighbors.end(), [ch](const auto &n) {
 				const auto &[neighbor, n_ch] = n;
 				return ch < n_ch;
@@ -38,12 +41,11 @@ auto low_points(const data_t &map) {
 	};
 
 	return map.all_points() |
-		views::filter([&map, is_low](const auto &p) {	// keep low points
-			const auto &[point, p_ch] = p;
-			return is_low(point, p_ch);
+		views::filter([is_low](const auto &p) {	// keep low points
+			return is_low(p, p.w);
 		}) |
 		views::transform([](const auto &p) {			// return only points
-			return p.first;
+			return point_t{p};
 		});
 		//  |
 		// ranges::to<vector<point_t>>();				// back to vector
@@ -80,7 +82,7 @@ const result_t part2(const data_t &map) {
 			if (!confirmed.contains(point)) {
 				confirmed.insert(point);
 
-				for (const auto &[neighbor, ch] : map.neighbors_of(point)) {
+				for (const auto &[neighbor, ch] : map.neighbors4(point)) {
 					if (ch != '9') {
 						tentative.push(neighbor);
 					}
@@ -106,46 +108,22 @@ const result_t part2(const data_t &map) {
 }
 
 const data_t read_data(const string &filename) {
-	return charmap_t::from_file(filename);
-}
-
-template <typename T>
-void print_result(T result, chrono::duration<double, milli> duration) {
-	const int time_width = 10;
-	const int time_precision = 4;
-	const int result_width = 15;
-
-	cout << std::setw(result_width) << std::right << result;
-
-	cout << " ("
-		 << std::setw(time_width) << std::fixed << std::right 
-		 << std::setprecision(time_precision)
-		 << duration.count() << "ms)";
-	cout << endl;
+	// border with '9' so basins and low points stop at the edge
+	input_view_t input(filename);
+	charmap_t map(input);
+	map.add_border('9');
+	return map;
 }
 
+#if !defined(AOC_SOLVER)
 int main(int argc, char *argv[]) {
-	const char *input_file = argv[1];
-	if (argc < 2) {
-		input_file = "test.txt";
-	}
-
-    auto start_time = chrono::high_resolution_clock::now();
-
-	auto data = read_data(input_file);
-
-	auto parse_time = chrono::high_resolution_clock::now();
-	print_result("parse", (parse_time - start_time));
-
-	result_t p1_result = part1(data);
-
-	auto p1_time = chrono::high_resolution_clock::now();
-	print_result(p1_result, (p1_time - parse_time));
-
-	result_t p2_result = part2(data);
-
-	auto p2_time = chrono::high_resolution_clock::now();
-	print_result(p2_result, (p2_time - p1_time));
+	return day_main<read_data, part1, part2>(argc, argv);
+}
+#else
+#include "aoc_solver.h"
 
-	print_result("total", (p2_time - start_time));
+// entry point for libaoc, see aoc_solver.h
+AOC_EXPORT const aoc_solver_t *aoc_solver() {
+	return make_solver<read_data, part1, part2>(AOC_DAY);
 }
+#endif
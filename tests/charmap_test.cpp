@@ -0,0 +1,48 @@
+#undef NDEBUG
+#include <cassert>		// assert macro
+#include <string>		// std::string
+#include <string_view>	// std::string_view
+
+#include "charmap.h"
+
+/* A map made by size is padded out to its stride with sentinel, so
+ * fill_ragged() sees every row size_x wide and leaves the map alone.
+ * 16 is the stride itself, 15 and 17 either side of it. */
+void test_sized_map_is_not_ragged() {
+	for (const dimension_t n : {1, 5, 15, 16, 17}) {
+		charmap_t map(n, 3, '.');
+		map.fill_ragged();
+		assert(map.size_x == n);
+		assert(map.row(2) == std::string(static_cast<size_t>(n), '.'));
+	}
+}
+
+// a ragged map read from text is filled out to its widest row
+void test_ragged_rows_are_filled() {
+	charmap_t map(std::string_view("ab\nabcd\na"));
+	map.fill_ragged('.');
+	assert(map.size_x == 4);
+	assert(map.row(0) == "ab..");
+	assert(map.row(1) == "abcd");
+	assert(map.row(2) == "a...");
+}
+
+// with a border the neighbors off the map read as the border char
+void test_border_neighbors() {
+	charmap_t map(std::string_view("12\n34"));
+	map.add_border('#');
+
+	const auto around = map.neighbors8({0, 0});
+	assert(around[0].second == '#');	// up left
+	assert(around[4].second == '2');	// right
+	assert(around[7].second == '4');	// down right
+	assert(map.neighbors4({1, 1})[1].second == '#');	// right of the last cell
+	assert(map.get_unchecked({-1, 0}) == '#');
+}
+
+int main() {
+	test_sized_map_is_not_ragged();
+	test_ragged_rows_are_filled();
+	test_border_neighbors();
+	return 0;
+}
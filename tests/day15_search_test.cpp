@@ -0,0 +1,76 @@
+#undef NDEBUG
+#include <cassert>		// assert macro
+#include <cstdint>		// uint32_t
+#include <string>		// std::string
+#include <string_view>	// std::string_view
+#include <tuple>		// std::tuple, std::get
+
+#include "charmap.h"
+#include "dijkstra.h"
+
+/* day15 answers with dijkstra_grid. astar_grid and bidirectional_grid
+ * are the same search done other ways, so all three must agree on the
+ * cost, and the path dijkstra_path gives back must add up to it. */
+void check_searches(const charmap_t &map) {
+	const point_t start(0, 0);
+	const point_t end(map.size_x-1, map.size_y-1);
+
+	auto [cost, dist, pred] = dijkstra_grid(map, start, end, true);
+	auto [astar_cost, astar_dist, astar_pred] = astar_grid(map, start, end);
+	assert(astar_cost == cost);
+	assert(bidirectional_grid(map, start, end) == cost);
+
+	const auto path = dijkstra_path(map, start, end, pred);
+	assert(path.front() == start && path.back() == end);
+
+	size_t risk = 0;
+	for (size_t i = 1; i < path.size(); i++) {
+		risk += static_cast<size_t>(map.get(path[i]) - '0');
+	}
+	assert(risk == cost);
+}
+
+// the example from the puzzle, lowest risk 40
+void test_example() {
+	charmap_t map(std::string_view(
+		"1163751742\n"
+		"1381373672\n"
+		"2136511328\n"
+		"3694931569\n"
+		"7463417111\n"
+		"1319128137\n"
+		"1359912421\n"
+		"3125421639\n"
+		"1293138521\n"
+		"2311944581"));
+	map.add_border('#');
+
+	assert(std::get<0>(dijkstra_grid(map, {0, 0}, {9, 9})) == 40);
+	check_searches(map);
+}
+
+/* Maps of digits from a fixed linear congruential sequence, square and
+ * not, with few or many 1s (cheapest steps) to move the A* bound around. */
+void test_generated() {
+	uint32_t seed = 15;
+	auto next = [&seed]() {
+		seed = seed * 1103515245u + 12345u;
+		return seed >> 16;
+	};
+
+	for (const auto &[size_x, size_y, low] : {std::tuple{1, 1, 1}, {7, 3, 1}, {3, 7, 2}, {40, 40, 1}, {64, 33, 3}}) {
+		charmap_t map(size_x, size_y);
+		for (const auto &p : map.all_points()) {
+			const auto range = static_cast<uint32_t>(10 - low);
+			map.set(p, static_cast<char>('0' + low + static_cast<int>(next() % range)));
+		}
+		map.add_border('#');
+		check_searches(map);
+	}
+}
+
+int main() {
+	test_example();
+	test_generated();
+	return 0;
+}
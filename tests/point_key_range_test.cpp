@@ -0,0 +1,18 @@
+#undef NDEBUG
+#include <csignal>		// signal, SIGABRT
+#include <cstdint>		// int64_t
+#include <unistd.h>		// _exit
+
+#include "point.h"
+
+/* One past the top of the range would alias the bottom of it, so making
+ * the key has to fail its assert; the abort is the pass. */
+int main() {
+	std::signal(SIGABRT, []([[maybe_unused]] int signal) {
+		_exit(0);
+	});
+
+	const point_t past{point_key_t::axis_offset, 0};
+	[[maybe_unused]] const point_key_t key(past);
+	return 1;
+}
@@ -0,0 +1,36 @@
+#undef NDEBUG
+#include <cassert>		// assert macro
+#include <cstdint>		// int64_t
+
+#include "point.h"
+#include "flat_point.h"
+
+constexpr int64_t lowest = -point_key_t::axis_offset;
+constexpr int64_t highest = point_key_t::axis_offset - 1;
+
+// the ends of the range come back as they went in, on every axis
+void test_range_ends_round_trip() {
+	for (const int64_t v : {lowest, lowest + 1, int64_t{-1}, int64_t{0}, highest - 1, highest}) {
+		const point_t p{v, -v - 1, v};
+		assert(point_key_t(p).to_point<point_t>() == p);
+	}
+}
+
+// points at the ends of the range and next to them are all different keys
+void test_range_ends_are_distinct() {
+	flat_point_set_t points;
+	for (const int64_t x : {lowest, lowest + 1, highest - 1, highest}) {
+		for (const int64_t y : {lowest, highest}) {
+			assert(points.insert(point_t{x, y}));
+		}
+	}
+	assert(points.size() == 8);
+	assert(points.contains(point_t{lowest, highest}));
+	assert(!points.contains(point_t{0, highest}));
+}
+
+int main() {
+	test_range_ends_round_trip();
+	test_range_ends_are_distinct();
+	return 0;
+}
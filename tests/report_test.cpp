@@ -0,0 +1,52 @@
+#undef NDEBUG
+#include <cassert>		// assert macro
+#include <algorithm>	// count
+#include <sstream>		// ostringstream, istringstream
+#include <string>		// std::string
+
+#include "report.h"
+
+// the columns on one csv line, no commas in these answers
+size_t columns(const std::string &line) {
+	return static_cast<size_t>(std::count(line.begin(), line.end(), ',')) + 1;
+}
+
+/* A part with an empty answer still has its column, so the header and
+ * the row line up whatever the answers are. */
+void test_csv_empty_answer() {
+	std::ostringstream out;
+	report_t report(report_format_t::csv, "input.txt", out);
+	report.parsed();
+	report.part("part1", std::string());
+	report.part("part2", 42);
+	report.done();
+
+	std::istringstream lines(out.str());
+	std::string header, row;
+	std::getline(lines, header);
+	std::getline(lines, row);
+
+	assert(header.find(",part1,") != std::string::npos);
+	assert(header.find(",part2,") != std::string::npos);
+	assert(header.find(",parse,") == std::string::npos);
+	assert(columns(header) == columns(row));
+	assert(row.find(",\"\",") != std::string::npos);
+}
+
+// json has the key for an empty answer too
+void test_json_empty_answer() {
+	std::ostringstream out;
+	report_t report(report_format_t::json, "input.txt", out);
+	report.parsed();
+	report.part("part1", std::string());
+	report.done();
+
+	assert(out.str().find("\"part1\": \"\"") != std::string::npos);
+	assert(out.str().find("\"parse\":") == std::string::npos);
+}
+
+int main() {
+	test_csv_empty_answer();
+	test_json_empty_answer();
+	return 0;
+}